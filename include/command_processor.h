@@ -38,10 +38,12 @@ private:
     class SystemErrorManager* systemErrorManager = nullptr;
     class InputManager* inputManager = nullptr;
     class SubsystemTimingMonitor* timingMonitor = nullptr;
-    
+    class MemoryMonitor* memoryMonitor = nullptr;
+    class ResponseStreamer* responseStreamer = nullptr;
+
     // Command handlers
     void handleHelp(char* response, size_t responseSize, bool fromMqtt);
-    void handleShow(char* response, size_t responseSize, bool fromMqtt);
+    void handleShow(char* param, char* response, size_t responseSize, bool fromMqtt);
     void handlePins(char* response, size_t responseSize, bool fromMqtt);
     void handlePin(char* param1, char* param2, char* param3, char* response, size_t responseSize);
     void handleSet(char* param, char* value, char* response, size_t responseSize);
@@ -54,6 +56,8 @@ private:
     void handleMqtt(char* param, char* response, size_t responseSize);
     void handleLogLevel(const char* param, char* response, size_t responseSize);
     void handleTiming(char* param, char* response, size_t responseSize);
+    void handleBench(char* param, char* response, size_t responseSize);
+    void handleProfile(char* param, char* value, char* name, char* response, size_t responseSize);
     
 public:
     CommandProcessor() = default;
@@ -68,6 +72,8 @@ public:
     void setSystemErrorManager(class SystemErrorManager* errorMgr) { systemErrorManager = errorMgr; }
     void setInputManager(class InputManager* input) { inputManager = input; }
     void setTimingMonitor(class SubsystemTimingMonitor* timing) { timingMonitor = timing; }
+    void setMemoryMonitor(class MemoryMonitor* memory) { memoryMonitor = memory; }
+    void setResponseStreamer(class ResponseStreamer* streamer) { responseStreamer = streamer; }
     
     // Main processing function
     bool processCommand(char* commandBuffer, bool fromMqtt, char* response, size_t responseSize);
@@ -0,0 +1,114 @@
+#pragma once
+
+#include <Arduino.h>
+#include <string.h>
+
+// Compile-time command token table for CommandProcessor (non-networking version)
+//
+// Command names are resolved through a table of precomputed FNV-1a hashes
+// searched with binary search, so the cost of parsing a command is flat
+// instead of a cascade of strcasecmp calls. The same table backs
+// CommandValidator::isValidCommand(), so the whitelist and the dispatch
+// switch can't drift apart.
+
+// Handler identifiers for the first command token
+enum class CommandId : uint8_t {
+    CMD_HELP,
+    CMD_SHOW,
+    CMD_PINS,
+    CMD_PIN,
+    CMD_SET,
+    CMD_RELAY,
+    CMD_DEBUG,
+    CMD_RESET,
+    CMD_TEST,       // Accepted but unhandled (reserved)
+    CMD_LOGLEVEL,
+    CMD_HEARTBEAT,  // Accepted but unhandled (reserved)
+    CMD_ERROR,
+    CMD_BYPASS,
+    CMD_TIMING,
+    CMD_DUMP,
+    CMD_BENCH,
+    CMD_PROFILE,
+    CMD_UNKNOWN
+};
+
+// FNV-1a (32-bit) over lowercased characters - constexpr so every table
+// entry's hash is computed at compile time
+constexpr uint32_t commandHash(const char* str) {
+    uint32_t hash = 2166136261u;
+    while (*str) {
+        char c = *str++;
+        if (c >= 'A' && c <= 'Z') c += 32;  // tolower without <ctype.h> (not constexpr)
+        hash ^= (uint8_t)c;
+        hash *= 16777619u;
+    }
+    return hash;
+}
+
+struct CommandEntry {
+    uint32_t hash;
+    CommandId id;
+    const char* name;  // For collision confirmation and help/diagnostics
+};
+
+// Table MUST stay sorted by hash (the static_asserts below enforce it at
+// compile time) - binary search in findCommand() depends on the ordering.
+// To add a command: append the entry, compile, and move it to where the
+// failing static_assert says it belongs.
+constexpr CommandEntry COMMAND_TABLE[] = {
+    { commandHash("pins"),      CommandId::CMD_PINS,      "pins" },
+    { commandHash("relay"),     CommandId::CMD_RELAY,     "relay" },
+    { commandHash("error"),     CommandId::CMD_ERROR,     "error" },
+    { commandHash("help"),      CommandId::CMD_HELP,      "help" },
+    { commandHash("profile"),   CommandId::CMD_PROFILE,   "profile" },
+    { commandHash("debug"),     CommandId::CMD_DEBUG,     "debug" },
+    { commandHash("bypass"),    CommandId::CMD_BYPASS,    "bypass" },
+    { commandHash("bench"),     CommandId::CMD_BENCH,     "bench" },
+    { commandHash("reset"),     CommandId::CMD_RESET,     "reset" },
+    { commandHash("pin"),       CommandId::CMD_PIN,       "pin" },
+    { commandHash("loglevel"),  CommandId::CMD_LOGLEVEL,  "loglevel" },
+    { commandHash("heartbeat"), CommandId::CMD_HEARTBEAT, "heartbeat" },
+    { commandHash("show"),      CommandId::CMD_SHOW,      "show" },
+    { commandHash("test"),      CommandId::CMD_TEST,      "test" },
+    { commandHash("timing"),    CommandId::CMD_TIMING,    "timing" },
+    { commandHash("set"),       CommandId::CMD_SET,       "set" },
+    { commandHash("dump"),      CommandId::CMD_DUMP,      "dump" },
+};
+
+constexpr size_t COMMAND_TABLE_SIZE = sizeof(COMMAND_TABLE) / sizeof(COMMAND_TABLE[0]);
+
+// Verify sort order and hash uniqueness at compile time
+constexpr bool commandTableSorted() {
+    for (size_t i = 1; i < COMMAND_TABLE_SIZE; i++) {
+        if (COMMAND_TABLE[i - 1].hash >= COMMAND_TABLE[i].hash) return false;
+    }
+    return true;
+}
+static_assert(commandTableSorted(),
+              "COMMAND_TABLE must be sorted by hash with no duplicates - "
+              "print commandHash(name) for the new entry and insert in order");
+
+// O(log n) lookup: binary search over the precomputed hashes, then a single
+// strcasecmp to confirm (guards against a hash collision with an unknown
+// token). Returns CMD_UNKNOWN if the token is not in the table.
+inline CommandId findCommand(const char* token) {
+    if (!token) return CommandId::CMD_UNKNOWN;
+
+    uint32_t hash = commandHash(token);
+    size_t low = 0;
+    size_t high = COMMAND_TABLE_SIZE;
+    while (low < high) {
+        size_t mid = low + (high - low) / 2;
+        if (COMMAND_TABLE[mid].hash < hash) {
+            low = mid + 1;
+        } else if (COMMAND_TABLE[mid].hash > hash) {
+            high = mid;
+        } else {
+            return (strcasecmp(token, COMMAND_TABLE[mid].name) == 0)
+                ? COMMAND_TABLE[mid].id
+                : CommandId::CMD_UNKNOWN;
+        }
+    }
+    return CommandId::CMD_UNKNOWN;
+}
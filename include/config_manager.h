@@ -19,6 +19,7 @@ struct CalibrationData {
     float sensorOffset;
     uint8_t filterMode;
     float emaAlpha;
+    uint8_t medianWindow;  // FILTER_MEDIAN_N window size (16-64 samples)
     uint8_t pinModesBitmap;
     uint32_t seqStableMs;
     uint32_t seqStartStableMs;
@@ -38,15 +39,45 @@ struct CalibrationData {
     float a5_adcVref;
     float a5_sensorGain;
     float a5_sensorOffset;
-    
+
+    // Adaptive pressure telemetry (change-driven publisher)
+    float pubDeadbandPsi;      // Movement since last send that triggers a publish
+    uint16_t pubMinIntervalMs; // Fastest change-driven send rate
+    uint16_t pubKeepaliveMs;   // Fallback cadence when the value is static
+
+    // Raw-ADC overpressure comparator hard ceiling (0 = disabled)
+    float overpressureCeilingPsi;
+
     // CRC32 checksum (must be last field)
     uint32_t crc32;
 };
 
+// One named profile bank in EEPROM: a name line followed by a full
+// CalibrationData image, whose magic + trailing crc32 also protect the
+// bank. Written through the same journaled path as the live config, so
+// an interrupted profile save fails validation instead of loading half
+// a profile.
+struct ProfileSlot {
+    char name[PROFILE_NAME_LEN];  // NUL-terminated; 0x00/0xFF first byte = unused
+    CalibrationData data;
+};
+
 class ConfigManager {
 private:
     CalibrationData config;
     bool configValid = false;
+
+    // Async save state - save() snapshots the config image and update()
+    // commits it to EEPROM a few bytes per loop pass. crc32 is the last
+    // field of CalibrationData, so linear write order commits the checksum
+    // last: a save interrupted by power loss fails CRC validation at the
+    // next boot instead of loading a half-written config.
+    static const size_t SAVE_CHUNK_BYTES = 8;
+    uint8_t pendingImage[sizeof(ProfileSlot)];  // Sized for the largest save target
+    int saveAddr = CALIB_EEPROM_ADDR;
+    size_t saveLength = 0;
+    size_t saveOffset = 0;
+    bool saveInProgress = false;
     
     // Pin mode configuration (true = NC, false = NO)
     bool pinIsNC[WATCH_PIN_COUNT] = {false};
@@ -76,7 +107,17 @@ public:
     
     // Load/Save
     bool load();
-    bool save();
+    bool save();          // Queues an async save; update() commits it
+    void update();        // Background save step (call from main loop)
+    void flushSave();     // Block until a pending save completes (init paths)
+    bool isSaveInProgress() const { return saveInProgress; }
+
+    // Profile banks: named CalibrationData slots in EEPROM. profileLoad
+    // replaces the live config and queues a save to the live slot; the
+    // caller hot-applies through the existing applyTo* paths.
+    bool profileSave(uint8_t slot, const char* name);
+    bool profileLoad(uint8_t slot);
+    bool profileGetName(uint8_t slot, char* nameOut, size_t nameSize);
     
     // Pin mode configuration
     void setPinMode(uint8_t pin, bool isNC);
@@ -116,6 +157,20 @@ public:
     // EMA Alpha configuration
     float getEmaAlpha() const { return config.emaAlpha; }
     void setEmaAlpha(float val) { config.emaAlpha = val; }
+
+    // Median window configuration (FILTER_MEDIAN_N)
+    uint8_t getMedianWindow() const { return config.medianWindow; }
+    void setMedianWindow(uint8_t val) { config.medianWindow = val; }
+
+    // Adaptive pressure telemetry configuration
+    float getPubDeadband() const { return config.pubDeadbandPsi; }
+    void setPubDeadband(float val) { config.pubDeadbandPsi = val; }
+    uint16_t getPubMinInterval() const { return config.pubMinIntervalMs; }
+    void setPubMinInterval(uint16_t val) { config.pubMinIntervalMs = val; }
+    float getOverpressureCeiling() const { return config.overpressureCeilingPsi; }
+    void setOverpressureCeiling(float val) { config.overpressureCeilingPsi = val; }
+    uint16_t getPubKeepalive() const { return config.pubKeepaliveMs; }
+    void setPubKeepalive(uint16_t val) { config.pubKeepaliveMs = val; }
     
     // Debug configuration
     bool getDebugEnabled() const { return config.debugEnabled; }
@@ -3,7 +3,7 @@
 #include <Arduino.h>
 
 // System Constants
-const unsigned long WATCHDOG_TIMEOUT_MS = 15000;
+const unsigned long WATCHDOG_TIMEOUT_MS = 500;  // Hardware watchdog window (see hardware_watchdog.h)
 const unsigned long MAIN_LOOP_TIMEOUT_MS = 10000;
 
 // Network Constants - Default fallback values (configure in arduino_secrets.h)
@@ -147,6 +147,15 @@ const float MAIN_PRESSURE_EXT_FSV = 5.0f;
 const float SAFETY_THRESHOLD_PSI = 2500.0f;
 const float SAFETY_HYSTERESIS_PSI = 10.0f;
 
+// Raw-ADC overpressure comparator: per-sample hard ceiling checked ahead
+// of the filter chain, with M-of-N confirmation so one ADC glitch can't
+// cut the relays. Ceiling sits above SAFETY_THRESHOLD_PSI - the filtered
+// path owns normal threshold handling, this path only catches spikes the
+// averaging window would sit on for hundreds of milliseconds.
+const float DEFAULT_OVERPRESSURE_CEILING_PSI = 2800.0f;
+const uint8_t OVERPRESSURE_CONFIRM_M = 3;  // Samples over ceiling needed...
+const uint8_t OVERPRESSURE_WINDOW_N = 4;   // ...within the last N samples
+
 // Pressure-based sequence control
 const float EXTEND_PRESSURE_LIMIT_PSI = 2300.0f;  // Pressure that triggers extend limit reached
 const float RETRACT_PRESSURE_LIMIT_PSI = 2300.0f; // Pressure that triggers retract limit reached
@@ -167,13 +176,28 @@ const size_t MAX_CMD_LENGTH = 16;
 const uint32_t CALIB_MAGIC = 0x43414C49; // 'CALI'
 const int CALIB_EEPROM_ADDR = 0;
 
+// Named configuration profile banks (summer/winter hydraulic setups etc.)
+// Placed well past the live config (0), the NAU7802 calibration block
+// (128) and the bench EEPROM scratch byte (1000); the stride leaves
+// headroom for CalibrationData growth without repacking the banks.
+const uint8_t PROFILE_SLOT_COUNT = 3;
+const uint8_t PROFILE_NAME_LEN = 16;       // Including NUL terminator
+const int PROFILE_EEPROM_BASE = 2048;
+const int PROFILE_EEPROM_STRIDE = 256;
+
 // Filter Types
-enum FilterMode { 
-    FILTER_NONE = 0, 
-    FILTER_MEDIAN3 = 1, 
-    FILTER_EMA = 2 
+enum FilterMode {
+    FILTER_NONE = 0,
+    FILTER_MEDIAN3 = 1,
+    FILTER_EMA = 2,
+    FILTER_MEDIAN_N = 3   // Sliding-window median (see median_filter.h)
 };
 
+// Sliding-window median filter (FILTER_MEDIAN_N) window bounds
+const size_t MEDIAN_WINDOW_MIN = 16;
+const size_t MEDIAN_WINDOW_MAX = 64;
+const size_t DEFAULT_MEDIAN_WINDOW = 32;
+
 // System States
 enum SystemState {
     SYS_INITIALIZING,
@@ -184,5 +208,5 @@ enum SystemState {
 };
 
 // Command validation
-extern const char* const ALLOWED_COMMANDS[];
+// First-token whitelist now lives in command_table.h (hashed dispatch table)
 extern const char* const ALLOWED_SET_PARAMS[];
\ No newline at end of file
@@ -0,0 +1,65 @@
+#pragma once
+
+#include <Arduino.h>
+
+// Flight recorder (non-networking version). When the safety system trips
+// or the loop times out, the LOG_CRITICAL lines only describe the
+// aftermath - the input edges, relay commands, and pressure values
+// leading up to the event are already gone. This keeps a fixed circular
+// buffer of compact binary records that InputManager, RelayController,
+// SequenceController and SafetySystem append to on every event. An
+// append is a handful of stores (no formatting, no allocation), so
+// recording stays enabled in production; dump() streams the history out
+// through TelemetryManager on emergencyStop(), loop timeout, or the
+// 'dump' command.
+
+enum FlightEventType : uint8_t {
+    FLIGHT_INPUT_EDGE = 1,  // detail = pin, value = debounced state
+    FLIGHT_RELAY = 2,       // detail = relay number, value bit0 = on, bit1 = manual
+    FLIGHT_SEQ_STATE = 3,   // detail = new state, value = previous state
+    FLIGHT_SAFETY = 4,      // detail = safety event code, value = pressure PSI
+    FLIGHT_PRESSURE = 5     // detail = sensor index, value = pressure PSI
+};
+
+struct FlightRecord {
+    uint32_t timestampUs;  // micros() at append
+    uint8_t eventType;     // FlightEventType
+    uint8_t detail;        // Event-specific (see enum comments)
+    uint16_t value;        // Event-specific (see enum comments)
+};
+
+class FlightRecorder {
+public:
+    FlightRecorder() = default;
+
+    // Append one record - four stores and an index increment
+    void record(FlightEventType type, uint8_t detail, uint16_t value) {
+        FlightRecord& r = records[head];
+        r.timestampUs = micros();
+        r.eventType = (uint8_t)type;
+        r.detail = detail;
+        r.value = value;
+        head = (head + 1) & (RING_SIZE - 1);
+        if (filled < RING_SIZE) filled++;
+        totalRecords++;
+    }
+
+    // Stream the buffered history (oldest first) through TelemetryManager
+    // and print a summary to Serial. Called from fault paths and 'dump' -
+    // blocking the loop here is acceptable.
+    void dump(const char* reason);
+
+    uint32_t getTotalRecords() const { return totalRecords; }
+    void getStatusString(char* buffer, size_t bufferSize);
+
+private:
+    static const size_t RING_SIZE = 128;  // Power of two, 1 KB of records
+
+    FlightRecord records[RING_SIZE];
+    size_t head = 0;       // Next write slot
+    size_t filled = 0;
+    uint32_t totalRecords = 0;
+};
+
+// Global flight recorder instance (defined in main.cpp)
+extern FlightRecorder flightRecorder;
@@ -0,0 +1,53 @@
+#pragma once
+
+#include <Arduino.h>
+
+// Hardware watchdog for the UNO R4's RA4M1 (non-networking version).
+// The soft checkSystemHealth() timer only fires if the loop is still
+// alive enough to call it - a loop wedged inside a blocking call never
+// trips it. The hardware watchdog resets the MCU a few hundred
+// milliseconds after the last kick no matter what the CPU is doing.
+//
+// A breadcrumb in .noinit RAM records which subsystem was entered last
+// (written by SubsystemTimingMonitor::startTiming); SRAM survives a
+// watchdog reset on this part, so after reboot the breadcrumb tells us
+// which subsystem hung. begin() reads and clears the reset-cause
+// register, so callers can log watchdog resets at boot.
+
+struct WatchdogBreadcrumb {
+    uint32_t magic;       // BREADCRUMB_MAGIC when the record is valid
+    uint8_t subsystemId;  // SubsystemID of the last startTiming() entry
+};
+
+extern WatchdogBreadcrumb g_watchdogBreadcrumb;
+
+class HardwareWatchdog {
+public:
+    static const uint32_t BREADCRUMB_MAGIC = 0x57444247;  // 'WDBG'
+
+    // Capture the reset cause, then arm the watchdog with the given
+    // window. Returns false on non-Renesas builds (no hardware watchdog).
+    static bool begin(uint32_t timeoutMs);
+
+    // Feed the watchdog - call once per loop pass from resetWatchdog()
+    static void kick();
+
+    // True if the boot that just happened was caused by the watchdog
+    // (valid after begin())
+    static bool resetByWatchdog();
+
+    // Subsystem recorded before the watchdog reset; 0xFF if the
+    // breadcrumb was invalid (e.g. first power-up)
+    static uint8_t lastSubsystemBeforeReset();
+
+    // Crash breadcrumb - a single store to .noinit RAM, cheap enough to
+    // call from every timing scope entry
+    static inline void noteSubsystemEntry(uint8_t subsystemId) {
+        g_watchdogBreadcrumb.magic = BREADCRUMB_MAGIC;
+        g_watchdogBreadcrumb.subsystemId = subsystemId;
+    }
+
+private:
+    static bool wdtResetDetected;
+    static uint8_t savedSubsystemId;
+};
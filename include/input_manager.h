@@ -3,12 +3,22 @@
 #include <Arduino.h>
 #include "constants.h"
 
+// Timestamped limit-switch edge captured by the pin-change ISRs (pins 6/7).
+// Recorded into a small lock-free ring buffer and drained/debounced in
+// InputManager::update(), so edge detection latency is independent of loop jitter.
+struct InputEdgeEvent {
+    uint8_t pin;                // Source pin (LIMIT_EXTEND_PIN or LIMIT_RETRACT_PIN)
+    bool rawLevel;              // digitalRead() level at capture time (HIGH = true)
+    unsigned long timestampUs;  // micros() inside the ISR
+};
+
 class InputManager {
 private:
     // Pin state tracking
     bool pinStates[WATCH_PIN_COUNT] = {false};
     bool lastReadings[WATCH_PIN_COUNT] = {false};
     unsigned long lastDebounceTime[WATCH_PIN_COUNT] = {0};
+    unsigned long lastEdgeTimestampUs[WATCH_PIN_COUNT] = {0};  // micros() of most recent raw edge
     
     // Configurable debounce timing for limit switches (pins 6,7)
     unsigned long pin6DebounceMs = 10;  // Default HIGH setting
@@ -20,9 +30,29 @@ private:
     // Debug control
     bool debugPinChanges = false;
     
-    // Change callback
-    void (*inputChangeCallback)(uint8_t pin, bool state, const bool* allStates) = nullptr;
-    
+    // Change callback (timestampUs = micros() at the raw edge, from the ISR for pins 6/7)
+    void (*inputChangeCallback)(uint8_t pin, bool state, const bool* allStates, unsigned long timestampUs) = nullptr;
+
+    // Interrupt capture path (pins 6/7)
+    void drainInterruptEvents();
+
+    // Direct-port snapshot mode (RA4M1): all watched pins are sampled from a
+    // couple of PIDR register reads per update instead of eight digitalRead()
+    // calls, so every pin is captured at the same instant.
+    struct SnapshotPort {
+        volatile const uint16_t* pidr;  // Port input data register
+        uint16_t value;                 // Latched value for this update pass
+    };
+    bool portSnapshotEnabled = false;
+    SnapshotPort snapshotPorts[WATCH_PIN_COUNT];  // Unique ports actually used
+    size_t snapshotPortCount = 0;
+    uint8_t pinPortSlot[WATCH_PIN_COUNT] = {0};   // Index into snapshotPorts
+    uint16_t pinBitMask[WATCH_PIN_COUNT] = {0};   // Bit within the port
+
+    void buildPortSnapshotTable();
+    void capturePortSnapshot();
+    bool readPinRawHigh(size_t index);  // Snapshot bit or digitalRead() fallback
+
 public:
     InputManager() = default;
     
@@ -34,8 +64,8 @@ public:
     
     // Configuration
     void setConfigManager(class ConfigManager* config) { configManager = config; }
-    void setChangeCallback(void (*callback)(uint8_t, bool, const bool*)) { 
-        inputChangeCallback = callback; 
+    void setChangeCallback(void (*callback)(uint8_t, bool, const bool*, unsigned long)) {
+        inputChangeCallback = callback;
     }
     void setDebugPinChanges(bool enabled) { debugPinChanges = enabled; }
     bool getDebugPinChanges() const { return debugPinChanges; }
@@ -54,4 +84,8 @@ public:
     
     // Force pin state refresh (after config changes)
     void refreshPinStates();
+
+    // ISR capture diagnostics
+    unsigned long getIsrEventCount() const;
+    unsigned long getIsrOverflowCount() const;
 };
\ No newline at end of file
@@ -1,6 +1,7 @@
 #pragma once
 
 #include <Arduino.h>
+#include <stdarg.h>
 
 // Syslog severity levels (RFC 3164)
 enum LogLevel {
@@ -30,7 +31,18 @@ public:
     
     // Generic logging function
     static void log(LogLevel level, const char* fmt, ...);
-    
+
+    // va_list variant so wrappers (e.g. debugPrintf) don't format twice
+    static void logv(LogLevel level, const char* fmt, va_list args);
+
+    // Deferred logging - hot-path call sites store the format pointer and raw
+    // argument words into a ring; formatting and Serial output happen in
+    // processDeferred() from the main loop. ERROR and above stay synchronous.
+    static void setDeferredLogging(bool enabled);
+    static bool isDeferredLogging();
+    static void processDeferred();
+    static uint32_t getDeferredDropCount();
+
     // Telemetry control - allows external control of non-critical logging
     static void setTelemetryEnabled(bool enabled);
     static bool isTelemetryEnabled();
@@ -44,9 +56,33 @@ private:
     static char logBuffer[512];
     static bool telemetryEnabled;
     static Stream* telemetryStream;
-    
+
+    // Deferred log record: fmt points at the call site's string literal
+    // (static storage), arguments are captured as raw 32-bit words and %s
+    // strings are copied into the record's pool since the source buffer may
+    // be reused before the drain step runs
+    static const uint8_t DEFERRED_RING_SIZE = 16;
+    static const uint8_t DEFERRED_MAX_ARGS = 4;
+    static const uint8_t DEFERRED_STR_POOL_SIZE = 48;
+    struct DeferredRecord {
+        const char* fmt;
+        uint32_t timestampMs;
+        uint8_t level;
+        uint8_t argCount;
+        uint32_t args[DEFERRED_MAX_ARGS];
+        char strPool[DEFERRED_STR_POOL_SIZE];
+    };
+    static DeferredRecord deferredRing[DEFERRED_RING_SIZE];
+    static uint8_t deferredHead;
+    static uint8_t deferredTail;
+    static uint32_t deferredDropCount;
+    static bool deferredEnabled;
+
     static bool shouldLog(LogLevel level);
     static const char* getLevelString(LogLevel level);
+    static bool enqueueDeferred(LogLevel level, const char* fmt, va_list args);
+    static void formatDeferred(const DeferredRecord& record, char* out, size_t outSize);
+    static void printLine(LogLevel level, uint32_t timestampMs, const char* text);
 };
 
 // Convenience macros for easier migration
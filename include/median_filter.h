@@ -0,0 +1,80 @@
+#pragma once
+
+#include <Arduino.h>
+#include "constants.h"
+
+// Sliding-window median filter backing FILTER_MEDIAN_N. Median-of-3 passes
+// sustained noise bursts straight through; a window of 16-64 samples
+// rejects them, but re-sorting the window per sample would be too slow on
+// the high-rate ADC path. This keeps the window incrementally sorted: a
+// FIFO ring tracks sample age while a parallel sorted array yields the
+// median by index. Insert/evict positions are found by binary search
+// (O(log n)); the shift is a bounded memmove inside a <=64-entry uint16_t
+// array, a handful of word copies on this core. No heap, fixed footprint.
+class SlidingMedianFilter {
+public:
+    // Resize the window (clamped to MEDIAN_WINDOW_MIN..MAX) and clear state
+    void reset(size_t windowSize) {
+        if (windowSize < MEDIAN_WINDOW_MIN) windowSize = MEDIAN_WINDOW_MIN;
+        if (windowSize > MEDIAN_WINDOW_MAX) windowSize = MEDIAN_WINDOW_MAX;
+        capacity = windowSize;
+        clear();
+    }
+
+    // Drop all samples, keep the configured window size
+    void clear() {
+        next = 0;
+        filled = 0;
+    }
+
+    size_t getWindowSize() const { return capacity; }
+
+    // Insert a sample (evicting the oldest once the window is full) and
+    // return the current median
+    uint16_t insert(uint16_t value) {
+        if (filled == capacity) {
+            removeSorted(fifo[next]);
+        }
+        fifo[next] = value;
+        next = (next + 1) % capacity;
+        insertSorted(value);
+        return median();
+    }
+
+    uint16_t median() const {
+        if (filled == 0) return 0;
+        return sorted[filled / 2];  // Upper median for even windows
+    }
+
+private:
+    // First index in sorted[] whose value is >= value
+    size_t lowerBound(uint16_t value) const {
+        size_t lo = 0;
+        size_t hi = filled;
+        while (lo < hi) {
+            size_t mid = (lo + hi) / 2;
+            if (sorted[mid] < value) lo = mid + 1;
+            else hi = mid;
+        }
+        return lo;
+    }
+
+    void insertSorted(uint16_t value) {
+        size_t pos = lowerBound(value);
+        memmove(&sorted[pos + 1], &sorted[pos], (filled - pos) * sizeof(uint16_t));
+        sorted[pos] = value;
+        filled++;
+    }
+
+    void removeSorted(uint16_t value) {
+        size_t pos = lowerBound(value);  // Matches some instance of value
+        memmove(&sorted[pos], &sorted[pos + 1], (filled - pos - 1) * sizeof(uint16_t));
+        filled--;
+    }
+
+    uint16_t fifo[MEDIAN_WINDOW_MAX];    // Sample age order; next is the oldest slot when full
+    uint16_t sorted[MEDIAN_WINDOW_MAX];  // Same samples, ascending
+    size_t capacity = DEFAULT_MEDIAN_WINDOW;
+    size_t next = 0;
+    size_t filled = 0;
+};
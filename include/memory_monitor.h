@@ -0,0 +1,50 @@
+#pragma once
+
+#include <Arduino.h>
+
+// Memory instrumentation (non-networking version). SystemStatus carried a
+// free_memory_bytes field that was never filled in, and the big stack
+// consumers (Logger's format buffer, checkSystemHealth()'s timing
+// analysis array, the command scratch buffers) all peak on top of each
+// other.
+// begin() paints the free region between the heap break and the stack
+// pointer with a known pattern; update() scans how much of the paint
+// survives, giving the worst-case stack depth actually reached instead
+// of a guess. Heap pressure is tracked as a low-water mark of the
+// break-to-stack gap sampled each update() - the firmware is statically
+// allocated by design, so a sampled minimum is an honest measure.
+class MemoryMonitor {
+public:
+    MemoryMonitor() = default;
+
+    // Paint the free region - call as early as possible in setup so the
+    // painted span covers everything below the init frames
+    void begin();
+
+    // Rescan the watermark and refresh the low-water stats (schedule on
+    // a slow cadence; cost is one word-compare pass over the remaining
+    // free region)
+    void update();
+
+    // Gap between heap break and current stack pointer, right now
+    uint32_t getFreeBytes() const;
+
+    // Smallest free gap ever observed by update()
+    uint32_t getFreeLowWaterBytes() const { return freeLowWater; }
+
+    // Painted bytes still untouched above the heap break - the margin
+    // left at the deepest stack excursion since begin()
+    uint32_t getStackHeadroomBytes() const { return stackHeadroom; }
+
+    // Status ("free=... lowWater=... stackHeadroom=... painted=...")
+    void getStatusString(char* buffer, size_t bufferSize);
+
+private:
+    static const uint32_t PAINT_WORD = 0xA5A5A5A5;
+
+    uint32_t* paintBase = nullptr;  // First painted word (above heap break)
+    uint32_t* paintTop = nullptr;   // One past the last painted word
+    uint32_t paintedBytes = 0;
+    uint32_t stackHeadroom = 0;
+    uint32_t freeLowWater = 0xFFFFFFFF;
+};
@@ -2,6 +2,7 @@
 
 #include <Arduino.h>
 #include "constants.h"
+#include "median_filter.h"
 
 enum PressureSensorType {
     SENSOR_HYDRAULIC,     // Main hydraulic system (A1)
@@ -9,6 +10,13 @@ enum PressureSensorType {
     SENSOR_COUNT
 };
 
+// High-rate acquisition: a 1 kHz timer interrupt samples both channels into
+// per-channel ring buffers; update() reduces the ring (mean/min/max) instead
+// of taking one polled sample per 100 ms, so the safety system sees
+// millisecond-fresh pressure and true peaks are captured between updates.
+static const size_t ADC_RING_SIZE = 128;        // Power of two, ~128 ms at 1 kHz
+static const uint32_t ADC_SAMPLE_RATE_HZ = 1000;
+
 class PressureSensorChannel {
 private:
     // Configuration
@@ -29,17 +37,57 @@ private:
     FilterMode filterMode = FILTER_MEDIAN3;
     float emaValue = 0.0f;
     float emaAlpha = 0.2f;
+    SlidingMedianFilter medianFilter;
+    int med3Prev1 = 0;  // Median-of-3 history (per channel)
+    int med3Prev2 = 0;
     
     // Current values
     float currentPressure = 0.0f;
+    float peakPressure = 0.0f; // Max over the last reduced ring window (high-rate mode)
     float lastVoltage = 0.0f; // Most recent computed average voltage (after filtering -> average counts)
-    
+
+    // High-rate acquisition ring - filled from the ADC timer ISR, reduced
+    // in update(). Head is only advanced by the ISR, tail only by update();
+    // if update() ever lags a full ring the oldest samples are overwritten.
+    volatile uint16_t adcRing[ADC_RING_SIZE];
+    volatile size_t adcRingHead = 0;
+    size_t adcRingTail = 0;
+    bool highRateEnabled = false;
+    uint16_t windowMinCounts = 0;
+    uint16_t windowMaxCounts = 0;
+    volatile uint32_t isrSampleCount = 0;
+
+    // Fixed-point conversion: adcVref, sensor gain/offset and the per-pin
+    // scaling model folded into one Q16.16 scale+bias at configuration
+    // time (recomputeConversion), so the per-sample path is an integer
+    // multiply-shift-add instead of a chain of float divides
+    int32_t psiScaleQ16 = 0;    // Q16.16 PSI per ADC count
+    int32_t psiBiasQ16 = 0;     // Q16.16 PSI at zero counts
+    int32_t psiClampLoQ16 = 0;  // Q16.16 reporting bounds
+    int32_t psiClampHiQ16 = 0;
+    float voltsPerCount = 0.0f; // For the diagnostic voltage readback only
+
+    // Raw-ADC overpressure comparator: each raw sample is compared against
+    // a counts ceiling precomputed from the PSI ceiling (recomputeConversion),
+    // with OVERPRESSURE_CONFIRM_M-of-OVERPRESSURE_WINDOW_N confirmation.
+    // Runs in the ISR path, so the trip handshake is flag-based: the ISR
+    // latches pending+timestamp, the fast path in the main loop services it.
+    float overpressureCeilingPsi = 0.0f;  // 0 = comparator disabled
+    uint16_t opCeilingCounts = 0xFFFF;    // Above any 10-bit sample when disabled
+    uint8_t opSampleWindow = 0;           // Shift register of recent compares
+    volatile bool opTripLatched = false;
+    volatile bool opTripPending = false;
+    volatile uint32_t opTripMicros = 0;
+
+    void feedOverpressureComparator(uint16_t rawCounts);
+
     // Helper methods
     int applyFilter(int rawValue);
     void updateSample(int filteredValue);
-    float computeAverageCount();
-    float voltageToPressure(float voltage);
-    
+    int32_t computeAverageCountQ16() const;
+    void recomputeConversion();
+    void reduceRing();
+
 public:
     PressureSensorChannel() = default;
     
@@ -49,22 +97,60 @@ public:
     // Main update (call regularly)
     void update();
     
-    // Configuration
-    void setMaxPressure(float maxPsi) { maxPressurePsi = maxPsi; }
-    void setAdcVref(float vref) { adcVref = vref; }
-    void setSensorGain(float gain) { sensorGain = gain; }
-    void setSensorOffset(float offset) { sensorOffset = offset; }
-    void setFilterMode(FilterMode mode) { filterMode = mode; if (mode == FILTER_EMA) emaValue = 0.0f; }
+    // Configuration - each calibration change refolds the Q16 conversion
+    void setMaxPressure(float maxPsi) { maxPressurePsi = maxPsi; recomputeConversion(); }
+    void setAdcVref(float vref) { adcVref = vref; recomputeConversion(); }
+    void setSensorGain(float gain) { sensorGain = gain; recomputeConversion(); }
+    void setSensorOffset(float offset) { sensorOffset = offset; recomputeConversion(); }
+    void setFilterMode(FilterMode mode) {
+        filterMode = mode;
+        if (mode == FILTER_EMA) emaValue = 0.0f;
+        if (mode == FILTER_MEDIAN_N) medianFilter.clear();
+    }
     void setEmaAlpha(float alpha) { if (alpha > 0.0f && alpha <= 1.0f) emaAlpha = alpha; }
-    
+    void setMedianWindow(size_t windowSize) { medianFilter.reset(windowSize); }
+
     // Getters for configuration
     float getAdcVref() const { return adcVref; }
     float getSensorGain() const { return sensorGain; }
     float getSensorOffset() const { return sensorOffset; }
-    
+    FilterMode getFilterMode() const { return filterMode; }
+    float getEmaAlpha() const { return emaAlpha; }
+    size_t getMedianWindow() const { return medianFilter.getWindowSize(); }
+    
+    // High-rate acquisition (called from the ADC sample ISR / PressureManager)
+    void setHighRateSampling(bool enabled) { highRateEnabled = enabled; }
+    bool isHighRateSampling() const { return highRateEnabled; }
+    void isrRecordSample(uint16_t rawCounts);
+
+    // Raw overpressure comparator. Trip flags are serviced by the fast
+    // path in the main loop (see checkOverpressureFastPath in main.cpp);
+    // the latch holds until the operator clears the safety state.
+    void setOverpressureCeiling(float psi) { overpressureCeilingPsi = psi; recomputeConversion(); }
+    float getOverpressureCeiling() const { return overpressureCeilingPsi; }
+    bool overpressureTripPending() const { return opTripPending; }
+    bool overpressureTripLatched() const { return opTripLatched; }
+    uint32_t overpressureTripMicros() const { return opTripMicros; }
+    void serviceOverpressureTrip() { opTripPending = false; }
+    void rearmOverpressure() { opTripLatched = false; opTripPending = false; opSampleWindow = 0; }
+
+    // Q16.16 counts -> Q16.16 PSI via the precomputed scale+bias (clamped
+    // to the reporting bounds). This IS the per-sample conversion; float
+    // appears only at the getPressure() boundary.
+    int32_t countsToPsiQ16(int32_t countsQ16) const {
+        int32_t psi = (int32_t)(((int64_t)countsQ16 * psiScaleQ16) >> 16) + psiBiasQ16;
+        if (psi < psiClampLoQ16) psi = psiClampLoQ16;
+        if (psi > psiClampHiQ16) psi = psiClampHiQ16;
+        return psi;
+    }
+
     // Current readings
     float getPressure() const { return currentPressure; }
+    float getPeakPressure() const { return peakPressure; }
     float getVoltage() const { return lastVoltage; }
+    uint16_t getWindowMinCounts() const { return windowMinCounts; }
+    uint16_t getWindowMaxCounts() const { return windowMaxCounts; }
+    uint32_t getIsrSampleCount() const { return isrSampleCount; }
     bool isReady() const { return samplesFilled > 0; }
     uint8_t getPin() const { return analogPin; }
     float getMaxPressure() const { return maxPressurePsi; }
@@ -73,21 +159,36 @@ public:
 class PressureManager {
 private:
     PressureSensorChannel sensors[SENSOR_COUNT];
-    unsigned long lastPublishTime = 0;
-    const unsigned long publishInterval = 10000; // 10 seconds
-    
+
+    // Adaptive change-driven publisher: send immediately when a channel
+    // moves more than the deadband since its last transmission (rate-capped
+    // by the min interval), fall back to a slow keepalive when static. A
+    // fixed 10 s interval both missed the ramp during a split and burned
+    // bandwidth re-sending identical idle values.
+    float publishDeadbandPsi = 10.0f;
+    unsigned long publishMinIntervalMs = 25;    // Matches the pressure task cadence
+    unsigned long publishKeepaliveMs = 10000;   // Old fixed interval as the floor
+    float lastSentPsi[SENSOR_COUNT] = {0.0f};
+    unsigned long lastSentMs[SENSOR_COUNT] = {0};
+
     // External dependencies removed - non-networking version
-    
+
+    void publishSensor(int index, unsigned long now);
+
 public:
     PressureManager() = default;
     
     // Initialization
     void begin();
-    
+
     // Network dependency injection removed - non-networking version
-    
+
     // Main update (call regularly)
     void update();
+
+    // High-rate acquisition control (1 kHz timer ISR into per-channel rings)
+    bool beginHighRateSampling();
+    bool isHighRateSampling() const { return sensors[SENSOR_HYDRAULIC].isHighRateSampling(); }
     
     // Individual sensor access
     float getHydraulicPressure() const { return sensors[SENSOR_HYDRAULIC].getPressure(); }
@@ -97,6 +198,19 @@ public:
     PressureSensorChannel& getSensor(PressureSensorType type) { return sensors[type]; }
     const PressureSensorChannel& getSensor(PressureSensorType type) const { return sensors[type]; }
     
+    // Raw overpressure comparator (main hydraulic channel only - A5 has
+    // no actuator to cut)
+    void setOverpressureCeiling(float psi) { sensors[SENSOR_HYDRAULIC].setOverpressureCeiling(psi); }
+    float getOverpressureCeiling() const { return sensors[SENSOR_HYDRAULIC].getOverpressureCeiling(); }
+
+    // Adaptive publisher configuration
+    void setPublishDeadband(float psi) { if (psi >= 0.0f) publishDeadbandPsi = psi; }
+    void setPublishMinInterval(unsigned long ms) { if (ms > 0) publishMinIntervalMs = ms; }
+    void setPublishKeepalive(unsigned long ms) { if (ms > 0) publishKeepaliveMs = ms; }
+    float getPublishDeadband() const { return publishDeadbandPsi; }
+    unsigned long getPublishMinInterval() const { return publishMinIntervalMs; }
+    unsigned long getPublishKeepalive() const { return publishKeepaliveMs; }
+
     // Status and publishing
     void publishPressures();
     void getStatusString(char* buffer, size_t bufferSize);
@@ -2,6 +2,7 @@
 
 #include <Arduino.h>
 #include "constants.h"
+#include "median_filter.h"
 
 class PressureSensor {
 private:
@@ -22,7 +23,8 @@ private:
     FilterMode filterMode = FILTER_MEDIAN3;
     float emaValue = 0.0f;
     float emaAlpha = 0.2f;
-    
+    SlidingMedianFilter medianFilter;
+
     // Current values
     float currentPressure = 0.0f;
     
@@ -46,15 +48,21 @@ public:
     void setMaxPressure(float maxPsi) { maxPressurePsi = maxPsi; }
     void setSensorGain(float gain) { sensorGain = gain; }
     void setSensorOffset(float offset) { sensorOffset = offset; }
-    void setFilterMode(FilterMode mode) { filterMode = mode; if (mode == FILTER_EMA) emaValue = 0.0f; }
+    void setFilterMode(FilterMode mode) {
+        filterMode = mode;
+        if (mode == FILTER_EMA) emaValue = 0.0f;
+        if (mode == FILTER_MEDIAN_N) medianFilter.clear();
+    }
     void setEmaAlpha(float alpha) { if (alpha > 0.0f && alpha <= 1.0f) emaAlpha = alpha; }
-    
+    void setMedianWindow(size_t windowSize) { medianFilter.reset(windowSize); }
+
     float getAdcVref() const { return adcVref; }
     float getMaxPressure() const { return maxPressurePsi; }
     float getSensorGain() const { return sensorGain; }
     float getSensorOffset() const { return sensorOffset; }
     FilterMode getFilterMode() const { return filterMode; }
     float getEmaAlpha() const { return emaAlpha; }
+    size_t getMedianWindow() const { return medianFilter.getWindowSize(); }
     
     // Current readings
     float getPressure() const { return currentPressure; }
@@ -6,48 +6,84 @@
 // Forward declaration
 class SystemErrorManager;
 
+// Queued relay command (asynchronous pipeline)
+struct RelayCommand {
+    uint8_t relayNumber;
+    bool on;
+    bool isManual;
+};
+
 class RelayController {
 private:
-    // Relay states (index 1-9 used, 0 unused)
+    // Relay states (index 1-9 used, 0 unused) - commanded state, updated at
+    // enqueue time; confirmation/retry happens asynchronously in update()
     bool relayStates[MAX_RELAYS + 1] = {false};
     bool boardPowered = false;
-    
+
     // Communication
     bool echoEnabled = true;
-    
+
     // Safety state
     bool safetyActive = false;
-    
-    // Response checking
+
+    // Asynchronous command pipeline
+    // Sized for the emergencyStop() worst case (relays 3-8 OFF, R9 ON,
+    // engine-stop R8 ON = 8 commands) arriving on top of a queue already
+    // holding pending sequence commands
+    static const uint8_t COMMAND_QUEUE_SIZE = 16;
+    RelayCommand commandQueue[COMMAND_QUEUE_SIZE];
+    uint8_t queueHead = 0;
+    uint8_t queueCount = 0;
+
+    // In-flight command and response matching
     SystemErrorManager* errorManager = nullptr;
     unsigned long lastCommandTime = 0;
     bool waitingForResponse = false;
     uint8_t retryCount = 0;
     uint8_t lastRelayNumber = 0;
     bool lastRelayState = false;
+    bool lastRelayManual = false;
+    char responseLine[24];
+    uint8_t responseLinePos = 0;
+
+    // Pre-formatted E-stop cutoff commands (built in begin())
+    char cutoffExtendCmd[12];
+    char cutoffRetractCmd[12];
     static const uint8_t MAX_RETRIES = 2;
     static const unsigned long RESPONSE_TIMEOUT_MS = 100;
-    
+
     // Helper methods
     void sendCommand(uint8_t relayNumber, bool on);
-    bool sendCommandWithRetry(uint8_t relayNumber, bool on);
-    bool waitForOkResponse();
+    bool enqueueCommand(uint8_t relayNumber, bool on, bool isManual, bool priority);
+    void transmitNextCommand();
+    void processResponseChars();
+    void handleCommandConfirmed();
+    void handleResponseTimeout();
     void ensurePowerOn();
-    
+
 public:
     RelayController() = default;
     
     // Initialization
     void begin();
     
-    // Main update (handles serial echo)
+    // Main update (drives the async command pipeline and serial echo)
     void update();
-    
-    // Relay control
+
+    // Relay control (non-blocking: enqueues and returns immediately)
     void setRelay(uint8_t relayNumber, bool on);
     void setRelay(uint8_t relayNumber, bool on, bool isManualCommand);
     bool getRelayState(uint8_t relayNumber) const;
+    // Re-command a relay to its current state, bypassing the
+    // already-in-state dedup (benchmark/diagnostic use - nothing moves)
+    bool resendRelayState(uint8_t relayNumber);
     void allRelaysOff();
+    bool isPipelineIdle() const { return queueCount == 0 && !waitingForResponse; }
+
+    // E-stop fast path: write the pre-formatted extend/retract OFF
+    // commands straight to the wire, bypassing the queue and response
+    // matching. Formatted once in begin() so this is two writes.
+    void emergencyCutoff();
     
     // Safety controls
     void enableSafety() { safetyActive = true; allRelaysOff(); }
@@ -0,0 +1,43 @@
+#pragma once
+
+#include <Arduino.h>
+
+// Non-blocking chunked Serial response writer.
+//
+// Command handlers used to build their whole reply in g_response_buffer and
+// processSerialCommands() pushed it out with a blocking Serial.print - a
+// bigger status line meant a longer loop stall, and SHARED_BUFFER_SIZE capped
+// how much a reply could say. Handlers now emit into this ring incrementally
+// and update() drains it to Serial from loop() passes, writing only what the
+// UART TX buffer can take without blocking. Output that does not fit the ring
+// is dropped (counted), never waited on.
+class ResponseStreamer {
+private:
+    // Power of 2 for cheap masking; sized for the largest multi-line replies
+    // (help, full show output) without approaching telemetry ring footprint
+    static const size_t STREAM_BUFFER_SIZE = 512;
+
+    uint8_t buffer[STREAM_BUFFER_SIZE];
+    volatile size_t head = 0;   // Producer (command handlers)
+    volatile size_t tail = 0;   // Consumer (update from loop)
+    uint32_t droppedBytes = 0;  // Overflow accounting - reply truncated, not blocked
+
+public:
+    ResponseStreamer() = default;
+
+    // Append raw text; returns bytes accepted (short on ring overflow)
+    size_t write(const char* text);
+    size_t write(const char* data, size_t length);
+
+    // printf-style convenience for handlers (formats into a stack buffer,
+    // so individual fragments should stay under ~160 chars)
+    void printf(const char* fmt, ...);
+
+    // Drain as much as Serial.availableForWrite() allows - call every loop pass
+    void update();
+
+    // Status
+    size_t pending() const;
+    bool isEmpty() const { return head == tail; }
+    uint32_t getDroppedBytes() const { return droppedBytes; }
+};
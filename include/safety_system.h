@@ -10,6 +10,14 @@ private:
     bool eStopActive = false;  // Tracks E-stop button state
     float lastPressure = 0.0f;
     unsigned long lastSafetyCheck = 0;
+    unsigned long lastFlightPressureMs = 0;  // Decimation timer for recorder pressure trail
+
+    // E-stop fast path reaction latency (microseconds)
+    uint32_t lastEStopLatencyUs = 0;
+    uint32_t maxEStopLatencyUs = 0;
+
+    // Raw overpressure comparator: last trip-to-cutoff latency (microseconds)
+    uint16_t lastOverpressureLatencyUs = 0;
     
     // Pin 11 safety status LED control
     bool safetyStatusLedState = false;      // Current pin 11 state
@@ -44,6 +52,11 @@ public:
     void emergencyStop(const char* reason);
     void activateEStop();  // E-stop specific activation
     void clearEStop();     // E-stop specific clearing
+
+    // Raw overpressure comparator trip: relays are already cut by the fast
+    // path - this does the latched handling and reports the latency
+    void notifyOverpressureTrip(float pressure, uint16_t tripLatencyUs);
+    uint16_t getOverpressureLatencyUs() const { return lastOverpressureLatencyUs; }
     
     // Manual control
     void activate(const char* reason = "manual");
@@ -51,6 +64,14 @@ public:
     void clearEmergencyStop();
     void setEngineStop(bool stop);  // For testing
     
+    // E-stop fast path reaction latency (detection to cutoff write complete)
+    void noteEStopReaction(unsigned long detectUs, unsigned long doneUs) {
+        lastEStopLatencyUs = doneUs - detectUs;
+        if (lastEStopLatencyUs > maxEStopLatencyUs) maxEStopLatencyUs = lastEStopLatencyUs;
+    }
+    uint32_t getEStopLatencyLastUs() const { return lastEStopLatencyUs; }
+    uint32_t getEStopLatencyMaxUs() const { return maxEStopLatencyUs; }
+
     // Status
     bool isActive() const { return safetyActive; }
     bool isEngineStopped() const { return engineStopped; }
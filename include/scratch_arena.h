@@ -0,0 +1,57 @@
+#pragma once
+
+#include <Arduino.h>
+#include "constants.h"
+
+// Static arena of fixed-size scratch slots for transient formatting.
+// Replaces the single shared g_message/g_response globals: every
+// formatting operation acquires its own slot, so a log or telemetry
+// call from callback context can no longer corrupt a half-built command
+// response, and nothing forces the formatting paths to serialize. No
+// heap - a fixed slot table and a use bitmask, with acquire/release in
+// a short interrupts-off critical section so the interrupt-driven fast
+// paths can take a slot safely.
+
+const uint8_t SCRATCH_SLOT_COUNT = 4;
+const size_t SCRATCH_SLOT_SIZE = SHARED_BUFFER_SIZE;
+
+class ScratchArena {
+private:
+    char slots[SCRATCH_SLOT_COUNT][SCRATCH_SLOT_SIZE];
+    volatile uint8_t inUseMask = 0;
+    uint8_t peakInUse = 0;       // High-water mark of concurrently held slots
+    uint32_t overflowCount = 0;  // Acquire attempts that found no free slot
+
+public:
+    ScratchArena() = default;
+
+    // Returns a SCRATCH_SLOT_SIZE buffer, or nullptr when every slot is
+    // taken (counted in overflowCount - callers must tolerate nullptr)
+    char* acquire();
+
+    // Returns a slot to the arena; pointers not owned by it are ignored
+    void release(char* buffer);
+
+    // Diagnostics (surfaced by "show memory")
+    uint8_t slotsInUse() const;
+    uint8_t getPeakInUse() const { return peakInUse; }
+    uint32_t getOverflowCount() const { return overflowCount; }
+};
+
+// Scope guard so a call site can't leak a slot on an early return
+class ScratchBuffer {
+private:
+    char* buf;
+
+public:
+    ScratchBuffer();
+    ~ScratchBuffer();
+
+    bool valid() const { return buf != nullptr; }
+    char* get() { return buf; }
+    size_t size() const { return buf ? SCRATCH_SLOT_SIZE : 0; }
+};
+
+// Global instance (defined in main.cpp), same access pattern as the
+// other cross-module singletons
+extern ScratchArena scratchArena;
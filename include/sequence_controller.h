@@ -24,6 +24,28 @@ enum SequenceType {
     SEQ_TYPE_MANUAL_RETRACT  // Manual retract with safety
 };
 
+// Cycle statistics - per-stage running aggregates maintained with O(1)
+// updates on state transitions. Stage 0 = extend (SEQ_STAGE1_*),
+// stage 1 = retract (SEQ_STAGE2_*).
+#define CYCLE_STAGE_COUNT 2
+#define CYCLE_RING_SIZE 8
+
+struct StageCycleStats {
+    uint32_t count;        // Completed stage runs since boot
+    uint32_t sumMs;        // Running sum for mean (65535 * count, ~65k cycles headroom)
+    uint16_t lastMs;
+    uint16_t minMs;
+    uint16_t maxMs;
+    float lastPeakPsi;     // Peak hydraulic pressure during the last run
+    float maxPeakPsi;      // Worst peak observed across all runs
+};
+
+struct CycleRecord {
+    uint16_t stage1Ms;
+    uint16_t stage2Ms;
+    float peakPsi;         // Peak hydraulic pressure across the whole cycle
+};
+
 class SequenceController {
 private:
     // State management
@@ -54,6 +76,21 @@ private:
     class InputManager* inputManager = nullptr;
     class SafetySystem* safetySystem = nullptr;
     
+    // Cycle statistics engine
+    StageCycleStats stageStats[CYCLE_STAGE_COUNT] = {};
+    CycleRecord recentCycles[CYCLE_RING_SIZE] = {};
+    uint8_t cycleRingHead = 0;
+    uint8_t cycleRingCount = 0;
+    uint32_t cyclesCompleted = 0;
+    uint32_t cyclesAborted = 0;
+    unsigned long stageStartMs = 0;
+    float stagePeakPsi = 0.0f;
+    float cyclePeakPsi = 0.0f;
+    bool cycleAbortPending = false;
+    void noteCycleTransition(SequenceState oldState, SequenceState newState, unsigned long now);
+    void closeStage(uint8_t stageIdx, unsigned long now);
+    void sampleStagePressure();
+
     // Helper methods
     void enterState(SequenceState newState);
     bool checkTimeout();
@@ -111,4 +148,10 @@ public:
     // Status for telemetry
     void getStatusString(char* buffer, size_t bufferSize);
     void publishIndividualData();
+
+    // Cycle statistics ("show cycles" / MSG_CYCLE_STATS)
+    void getCycleStatsString(char* buffer, size_t bufferSize);
+    void publishCycleStats();
+    uint32_t getCompletedCycles() const { return cyclesCompleted; }
+    uint32_t getAbortedCycles() const { return cyclesAborted; }
 };
\ No newline at end of file
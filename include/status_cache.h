@@ -0,0 +1,76 @@
+#pragma once
+
+#include <Arduino.h>
+
+// Preformatted status snapshot for the "show" command. Operators poll
+// "show" from scripts every few seconds, and each request used to walk
+// five getStatusString() chains full of float snprintf while the loop
+// waited. The cache keeps one formatted buffer per section; subsystems
+// mark their section dirty on state change and a scheduled step
+// reformats at most one dirty section per pass. handleShow() then just
+// streams the cached block - request latency is a memcpy, and polling
+// an unchanged system reformats nothing.
+//
+// Sections whose content tracks a live analog value (pressure, safety)
+// are timer-dirtied at display resolution instead of per-sample.
+
+enum StatusSection : uint8_t {
+    STATUS_SECTION_PRESSURE = 0,
+    STATUS_SECTION_SEQUENCE,
+    STATUS_SECTION_RELAY,
+    STATUS_SECTION_SAFETY,
+    STATUS_SECTION_ERRORS,
+    STATUS_SECTION_COUNT
+};
+
+class StatusCache {
+private:
+    // Section buffers - same sizes the old handleShow() locals used
+    char pressureBuf[96];
+    char sequenceBuf[80];
+    char relayBuf[80];
+    char safetyBuf[48];
+    char errorBuf[48];
+
+    uint8_t dirtyMask = 0;
+    unsigned long lastAnalogRefresh = 0;
+    static const unsigned long ANALOG_REFRESH_MS = 250;  // Display resolution
+
+    // Subsystem sources (injected from main)
+    class PressureManager* pressureManager = nullptr;
+    class SequenceController* sequenceController = nullptr;
+    class RelayController* relayController = nullptr;
+    class SafetySystem* safetySystem = nullptr;
+    class SystemErrorManager* systemErrorManager = nullptr;
+
+    void refreshSection(StatusSection section);
+
+public:
+    StatusCache() = default;
+
+    void setPressureManager(class PressureManager* pm) { pressureManager = pm; }
+    void setSequenceController(class SequenceController* sc) { sequenceController = sc; }
+    void setRelayController(class RelayController* rc) { relayController = rc; }
+    void setSafetySystem(class SafetySystem* ss) { safetySystem = ss; }
+    void setSystemErrorManager(class SystemErrorManager* em) { systemErrorManager = em; }
+
+    // Format every section once so the cache is never empty
+    void begin();
+
+    // Background step: timer-dirty the analog sections, then reformat at
+    // most one dirty section (bounded work between loop passes)
+    void update();
+
+    // Event hook for subsystems - cheap bit set, callable from anywhere
+    void markDirty(StatusSection section) { dirtyMask |= (uint8_t)(1 << section); }
+
+    // Cached section text (always NUL-terminated)
+    const char* getSection(StatusSection section) const;
+
+    // Assemble the full status line from the cached sections
+    void getStatusLine(char* buffer, size_t bufferSize);
+};
+
+// Global instance (defined in main.cpp) so subsystem mutation points can
+// mark their section dirty without plumbing a pointer everywhere
+extern StatusCache statusCache;
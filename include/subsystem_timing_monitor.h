@@ -11,30 +11,57 @@ enum class SubsystemID {
     INPUT_MANAGER,
     SYSTEM_ERROR_MANAGER,
     SAFETY_SYSTEM,
+    TELEMETRY_MANAGER,
     COMMAND_PROCESSING_SERIAL,
     MAIN_LOOP_TOTAL,
     COUNT  // Keep this last - used for array sizing
 };
 
-// Timing statistics for each subsystem
+// Number of log2 histogram buckets: bucket b counts durations in
+// [2^b, 2^(b+1)) microseconds; the top bucket is open-ended (~33s+)
+static const uint8_t TIMING_HISTOGRAM_BUCKETS = 26;
+
+// Timing statistics for each subsystem (all durations in microseconds -
+// the loop normally runs well under 1 ms, so millisecond resolution
+// quantized nearly every sample to zero)
 struct SubsystemTiming {
     const char* name;
-    unsigned long totalTime;
-    unsigned long maxTime;
+    uint64_t totalTime;          // Accumulated microseconds
+    unsigned long maxTime;       // Worst-case microseconds
     unsigned long callCount;
     unsigned long warningCount;
-    unsigned long lastCallTime;
+    unsigned long lastCallTime;  // Microseconds
     bool isActive;  // Currently being timed
-    unsigned long startTime;
+    unsigned long startTime;     // micros() captured at startTiming()
+    uint32_t histogram[TIMING_HISTOGRAM_BUCKETS];  // log2 duration buckets
 };
 
-// Configurable timing thresholds
+// Configurable timing thresholds (milliseconds - the external API keeps
+// ms units; endTiming() converts when comparing against micros durations)
 struct TimingThresholds {
     unsigned long warningThreshold;  // Warn if subsystem takes longer than this
     unsigned long criticalThreshold; // Critical if subsystem takes longer than this
     bool enableLogging;              // Enable detailed timing logs
 };
 
+// Loop iteration jitter tracking. A healthy average loop frequency hides
+// the occasional 100 ms outlier from blocking I/O, so every loop-to-loop
+// interval feeds a log2 histogram plus a rolling worst case, and outliers
+// past the threshold snapshot which subsystem consumed the time.
+struct LoopJitterStats {
+    uint32_t histogram[TIMING_HISTOGRAM_BUCKETS];  // log2 interval buckets (us)
+    unsigned long count;             // Iterations measured
+    unsigned long worstUs;           // Rolling worst interval
+    unsigned long worstAtMs;         // millis() when the worst was set
+    unsigned long outlierCount;      // Intervals past the threshold
+    unsigned long outlierThresholdUs;
+    unsigned long lastOutlierUs;     // Most recent outlier interval
+    unsigned long lastOutlierSubsystemUs;  // That subsystem's lastCallTime
+    uint8_t lastOutlierSubsystem;    // SubsystemID; 0xFF = none yet
+    unsigned long prevIterationUs;   // micros() at the previous call
+    bool primed;                     // First call only seeds prevIterationUs
+};
+
 class SubsystemTimingMonitor {
 public:
     SubsystemTimingMonitor();
@@ -65,10 +92,27 @@ public:
     void logTimingReport();
     void resetStatistics();
     
+    // Percentile queries (approximate - returns the upper bound of the
+    // log2 bucket containing the requested percentile, in microseconds)
+    unsigned long getPercentileUs(SubsystemID subsystem, uint8_t percentile);
+
+    // Publish per-subsystem percentile stats as binary telemetry
+    void publishTimingStats();
+
+    // Loop jitter tracking - call once at the top of every loop pass
+    void noteLoopIteration();
+    void setLoopOutlierThreshold(unsigned long us) { loopStats.outlierThresholdUs = us; }
+    unsigned long getLoopOutlierThresholdUs() const { return loopStats.outlierThresholdUs; }
+    void getLoopStatsString(char* buffer, size_t bufferSize);
+    void publishLoopStats();
+
+    // Name lookup by raw subsystem id (e.g. the watchdog crash breadcrumb)
+    const char* getSubsystemNameById(uint8_t id);
+
     // Timeout analysis
     void analyzeTimeout(char* analysis, size_t bufferSize);
     SubsystemID getSlowestSubsystem();
-    unsigned long getTotalExecutionTime();
+    uint64_t getTotalExecutionTime();
     
     // Health monitoring
     bool hasAnyWarnings();
@@ -77,6 +121,7 @@ public:
 
 private:
     SubsystemTiming timings[static_cast<int>(SubsystemID::COUNT)];
+    LoopJitterStats loopStats;
     TimingThresholds globalThresholds;
     TimingThresholds subsystemThresholds[static_cast<int>(SubsystemID::COUNT)];
     
@@ -27,6 +27,19 @@ enum ErrorLedPattern {
     LED_FAST_BLINK = 3          // Critical errors - fast blink (1Hz)
 };
 
+// Per-code dedup/rate-limit slot. Error codes are single bits, so the
+// slot index is just __builtin_ctz(code) - no table scan.
+#define ERROR_CODE_SLOTS 8
+
+struct ErrorCodeStats {
+    uint32_t occurrences;           // Total reports since boot
+    uint32_t suppressedSinceReport; // Reports swallowed since last summary
+    unsigned long firstMs;          // millis() of first report
+    unsigned long lastMs;           // millis() of most recent report
+    uint8_t tokens;                 // Token bucket for sendSystemError()
+    unsigned long lastRefillMs;     // Lazy refill reference time
+};
+
 class SystemErrorManager {
 private:
     uint8_t activeErrors = 0;           // Bitmask of active errors
@@ -35,9 +48,19 @@ private:
     bool ledState = false;              // Current mill lamp state (pin 9)
     bool builtinLedState = false;       // Current LED_BUILTIN state (pin 13)
     unsigned long errorStartTime = 0;   // When first error occurred
-    
+
     // Network manager removed - non-networking version
-    
+
+    // O(1) per-code dedup: occurrence counters plus a token bucket so a
+    // flapping source costs a counter increment, not a telemetry message
+    static const uint8_t ERROR_TOKEN_CAPACITY = 3;
+    static const unsigned long ERROR_TOKEN_REFILL_MS = 5000;
+    static const unsigned long ERROR_SUMMARY_INTERVAL_MS = 30000;
+    ErrorCodeStats codeStats[ERROR_CODE_SLOTS] = {};
+    unsigned long lastSummaryTime = 0;
+    bool takeToken(uint8_t slot, unsigned long now);
+    void publishSuppressedSummary(unsigned long now);
+
     // LED control
     void updateLED();
     ErrorLedPattern getLedPattern() const;
@@ -72,6 +95,7 @@ public:
     // Status reporting
     void getStatusString(char* buffer, size_t bufferSize);
     void listActiveErrors(char* buffer, size_t bufferSize);
+    void getErrorStatsString(char* buffer, size_t bufferSize);
     int getActiveErrorCount() const;
     const char* getCurrentLedPatternString() const;
 };
\ No newline at end of file
@@ -0,0 +1,49 @@
+#pragma once
+
+#include <Arduino.h>
+
+// Cooperative rate-based task scheduler for the main loop (non-networking
+// version). Fixed static table, no heap: each subsystem registers its
+// update step with a period, and runOnce() executes whatever is due each
+// pass. Table order is priority order - safety-relevant tasks register
+// first so they always run before housekeeping in the same pass. A period
+// of 0 means "every pass" (input/safety/relay paths). The scheduler only
+// idle-sleeps when no task is due, which with any period-0 task registered
+// means never - the old unconditional delay(1) is gone.
+
+struct ScheduledTask {
+    const char* name;
+    void (*run)();
+    unsigned long periodMs;   // 0 = run every pass
+    unsigned long lastRunMs;  // millis() of last execution
+    uint32_t runCount;
+};
+
+class TaskScheduler {
+public:
+    TaskScheduler();
+
+    // Register a task; returns false if the table is full. Call in
+    // priority order - runOnce() executes due tasks in registration order.
+    bool addTask(const char* name, void (*run)(), unsigned long periodMs);
+
+    // Execute all due tasks once; idle-sleeps only if nothing was due
+    void runOnce();
+
+    // Milliseconds until the next timed task is due (0 if one is due now
+    // or any every-pass task is registered)
+    unsigned long msUntilNextDue() const;
+
+    // Adjust a task's period at runtime (returns false if name not found)
+    bool setTaskPeriod(const char* name, unsigned long periodMs);
+
+    // Status
+    void getStatusString(char* buffer, size_t bufferSize);
+
+private:
+    static const uint8_t MAX_TASKS = 24;
+    static const unsigned long MAX_IDLE_SLEEP_MS = 5;  // Bound sleep so serial input stays responsive
+
+    ScheduledTask tasks[MAX_TASKS];
+    uint8_t taskCount;
+};
@@ -28,7 +28,12 @@ enum MessageType : uint8_t {
     MSG_SYSTEM_ERROR = 0x14,
     MSG_SAFETY_EVENT = 0x15,
     MSG_SYSTEM_STATUS = 0x16,
-    MSG_SEQUENCE_EVENT = 0x17
+    MSG_SEQUENCE_EVENT = 0x17,
+    MSG_TIMING_STATS = 0x18,
+    MSG_FLIGHT_RECORD = 0x19,
+    MSG_LOOP_STATS = 0x1A,
+    MSG_CYCLE_STATS = 0x1B,
+    MSG_LINK_STATS = 0x1C
 };
 
 // Input types
@@ -119,23 +124,26 @@ struct SystemError {
     char description[24];       // Truncated description
 };
 
-// Safety Event (3 bytes payload)
+// Safety Event (4 bytes payload)
 struct SafetyEvent {
     MessageHeader header;
     uint8_t event_type;         // SafetyEventType
     uint8_t flags;              // Bit 0: is_active
-    uint8_t reserved;           // For alignment
+    uint16_t trip_latency_us;   // Raw overpressure comparator: trip to relay cutoff (0 = n/a)
 };
 
-// System Status (12 bytes payload)
+// System Status (18 bytes payload)
 struct SystemStatus {
     MessageHeader header;
     uint32_t uptime_ms;         // System uptime
     uint16_t loop_frequency_hz; // Main loop frequency
-    uint16_t free_memory_bytes; // Available memory
+    uint16_t free_memory_bytes; // Current heap-to-stack gap (capped at 65535)
     uint8_t active_error_count; // Number of active errors
     uint8_t flags;              // Bit 0: safety_active, Bit 1: estop_active, Bits 2-5: sequence_state, Bits 6-7: mill_lamp_pattern
-    uint16_t reserved;          // For alignment
+    uint16_t stack_headroom_bytes; // Painted-stack margin at deepest excursion (was reserved)
+    uint16_t estop_latency_last_us; // E-stop fast path: detection to cutoff write, last event
+    uint16_t estop_latency_max_us;  // E-stop fast path: worst case since boot
+    uint16_t time_to_safe_ms;       // Reset to safety-armed (fast boot path)
 };
 
 // Sequence Event (4 bytes payload)
@@ -146,6 +154,66 @@ struct SequenceEvent {
     uint16_t elapsed_time_ms;   // Time in step (max 65 seconds)
 };
 
+// Flight Record (8 bytes payload) - one entry of the pre-fault event
+// history kept by FlightRecorder, streamed out on dump
+struct FlightRecordMsg {
+    MessageHeader header;
+    uint32_t timestamp_us;      // micros() when the event was recorded
+    uint8_t event_type;         // FlightEventType
+    uint8_t detail;             // Event-specific (pin / relay / state)
+    uint16_t value;             // Event-specific (state / flags / PSI)
+};
+
+// Subsystem Timing Stats (22 bytes payload) - per-subsystem latency
+// percentiles from the log2 histograms in SubsystemTimingMonitor
+struct TimingStats {
+    MessageHeader header;
+    uint8_t subsystem_id;       // SubsystemID enum value
+    uint8_t reserved;           // For alignment
+    uint32_t p50_us;            // Median duration
+    uint32_t p95_us;
+    uint32_t p99_us;
+    uint32_t max_us;            // Worst case observed
+    uint32_t call_count;        // Samples since last reset
+};
+
+// Loop Jitter Stats (70 bytes payload) - log2 histogram of loop-to-loop
+// intervals plus rolling worst case and the last outlier's attribution
+struct LoopStatsMsg {
+    MessageHeader header;
+    uint32_t loop_count;         // Iterations measured since reset
+    uint32_t worst_us;           // Rolling worst interval
+    uint32_t outlier_count;      // Intervals past the configured threshold
+    uint32_t last_outlier_us;    // Most recent outlier interval
+    uint8_t last_outlier_subsystem;  // SubsystemID; 0xFF = none
+    uint8_t reserved;
+    uint16_t bucket_counts[26];  // Bucket b = [2^b, 2^(b+1)) us, saturated
+};
+
+// Cycle Statistics (32 bytes payload) - per-stage split cycle timing
+// aggregates from SequenceController, sent after each completed cycle
+struct CycleStatsMsg {
+    MessageHeader header;
+    uint32_t completed_count;    // Full extend->retract cycles since boot
+    uint32_t aborted_count;      // Cycles ended by abort/timeout
+    // Per stage (0=extend, 1=retract): last/min/max/mean ms, then
+    // last/max peak hydraulic pressure in 0.1 PSI steps
+    uint16_t stage_stats[2][6];
+};
+
+// Link Stats (20 bytes payload) - TX queue accounting so the receiver
+// can quantify loss behind sequence_id gaps instead of guessing
+struct LinkStatsMsg {
+    MessageHeader header;
+    uint32_t enqueued;          // Messages offered to the TX queue since boot
+    uint32_t sent;              // Messages batched onto the wire
+    uint32_t dropped_bulk;      // Bulk messages dropped oldest-first under load
+    uint32_t dropped_critical;  // Stays 0 unless the queue fills with critical traffic
+    uint16_t backpressure;      // Frame flushes deferred by a full TX ring (capped)
+    uint8_t peak_depth;         // Worst queue depth observed
+    uint8_t depth;              // Queue depth at send time
+};
+
 #pragma pack(pop)
 
 // Mill lamp patterns for encoding
@@ -181,12 +249,26 @@ enum ErrorSeverity : uint8_t {
 class TelemetryManager {
 public:
     TelemetryManager();
-    
+
     // Initialize with SoftwareSerial pins
     void begin(uint8_t rxPin, uint8_t txPin, unsigned long baud = 57600);
-    
-    // Initialize with existing SoftwareSerial instance
+
+    // Initialize with existing SoftwareSerial instance (fallback path)
     void begin(SoftwareSerial* existingSerial);
+
+    // Initialize with a hardware UART (preferred: TX is interrupt-driven in
+    // the core, so sendMessage() is a memcpy into the ring and returns in
+    // microseconds instead of bit-banging with interrupts masked)
+    void begin(HardwareSerial* hwSerial, unsigned long baud = 115200);
+
+    // Memory stats source for sendSystemStatus()
+    void setMemoryMonitor(class MemoryMonitor* monitor) { memoryMonitor = monitor; }
+
+    // E-stop latency source for sendSystemStatus()
+    void setSafetySystem(class SafetySystem* safety) { safetySystem = safety; }
+
+    // Boot-to-safe-state metric recorded by initializeSystem()
+    void setTimeToSafeState(uint32_t us) { timeToSafeStateUs = us; }
     
     // Send telemetry messages
     void sendDigitalInput(uint8_t pin, bool state, bool isDebounced, uint16_t debounceTime, Telemetry::InputType inputType);
@@ -194,24 +276,94 @@ public:
     void sendRelayEvent(uint8_t relayNumber, bool state, bool isManual, bool success, Telemetry::RelayType relayType);
     void sendPressureReading(uint8_t sensorPin, float pressurePsi, uint16_t rawValue, uint8_t pressureType, bool isFault = false);
     void sendSystemError(uint8_t errorCode, const char* description, Telemetry::ErrorSeverity severity, bool acknowledged, bool active);
-    void sendSafetyEvent(uint8_t eventType, bool isActive);
+    void sendSafetyEvent(uint8_t eventType, bool isActive, uint16_t tripLatencyUs = 0);
     void sendSystemStatus();
     void sendSequenceEvent(uint8_t eventType, uint8_t stepNumber, uint16_t elapsedTime);
-    
+    void sendTimingStats(uint8_t subsystemId, uint32_t p50Us, uint32_t p95Us, uint32_t p99Us, uint32_t maxUs, uint32_t callCount);
+    void sendFlightRecord(uint32_t timestampUs, uint8_t eventType, uint8_t detail, uint16_t value);
+    void sendLoopStats(const uint32_t* histogram, uint32_t loopCount, uint32_t worstUs,
+                       uint32_t outlierCount, uint32_t lastOutlierUs, uint8_t lastOutlierSubsystem);
+    void sendCycleStats(uint32_t completedCount, uint32_t abortedCount,
+                        const uint16_t* stage1Stats, const uint16_t* stage2Stats);
+
     // Periodic update (call from main loop)
     void update();
+
+    // Block until the batch and TX ring have drained (bounded by maxWaitMs).
+    // Only for fault-path dumps where stalling the loop is acceptable.
+    void flushBlocking(unsigned long maxWaitMs);
     
     // Statistics
     uint32_t getMessagesSent() const { return messagesSent; }
     uint32_t getBytesTransmitted() const { return bytesTransmitted; }
-    
+    uint32_t getTxOverflowCount() const { return txOverflowCount; }
+    uint32_t getFramesSent() const { return framesSent; }
+    bool isUsingHardwareUart() const { return usingHardwareUart; }
+
 private:
-    SoftwareSerial* telemetrySerial;
+    Stream* telemetrySerial;
+    class MemoryMonitor* memoryMonitor = nullptr;
+    class SafetySystem* safetySystem = nullptr;
+    uint32_t timeToSafeStateUs = 0;
+    bool usingHardwareUart;
     uint8_t sequenceId;
     uint32_t lastHeartbeat;
     uint32_t messagesSent;
     uint32_t bytesTransmitted;
-    
+    uint32_t txOverflowCount;
+    uint32_t framesSent;
+
+    // Batch buffer: messages accumulate as [size][payload] records and are
+    // flushed as one COBS-encoded, CRC16-protected frame when the buffer
+    // fills or the flush timer in update() expires. The 0x00 delimiter never
+    // appears inside an encoded frame, so the receiver resyncs in O(1) after
+    // a dropped byte instead of scanning for a plausible header.
+    static const size_t BATCH_BUFFER_SIZE = 128;
+    static const unsigned long BATCH_FLUSH_INTERVAL_MS = 20;
+    static const uint8_t FRAME_DELIMITER = 0x00;
+    uint8_t batchBuffer[BATCH_BUFFER_SIZE];
+    size_t batchLength;
+    uint32_t lastBatchFlush;
+    void flushBatch();
+    static uint16_t crc16(const uint8_t* data, size_t len);
+    static size_t cobsEncode(const uint8_t* src, size_t len, uint8_t* dst);
+
+    // TX ring buffer: flushBatch() copies encoded frames in, update() drains
+    // only what the backend can take without blocking
+    static const size_t TX_RING_SIZE = 512;
+    uint8_t txRing[TX_RING_SIZE];
+    size_t txRingHead;  // Next write position
+    size_t txRingTail;  // Next read position
+    size_t txRingFree() const;
+    void txRingPush(const uint8_t* data, size_t len);
+    void drainTxRing();
+
+    // Priority staging queue: sendMessage() lands here, not in the batch.
+    // Safety/error/relay/sequence traffic is never dropped; bulk traffic
+    // (pressure, status, timing) is dropped oldest-first when the queue
+    // backs up. Messages only move to the batch when the TX ring can take
+    // the resulting frame, so overload accumulates here where the drop
+    // policy is class-aware instead of vanishing as whole frames.
+    static const uint8_t TX_QUEUE_SLOTS = 12;
+    static const uint8_t TX_QUEUE_MSG_MAX = 80;   // >= largest message (LoopStatsMsg, 76)
+    static const unsigned long LINK_STATS_INTERVAL_MS = 10000;
+    struct QueueSlot {
+        uint8_t len;       // 0 = dropped in place (tombstone)
+        uint8_t critical;
+        uint8_t data[TX_QUEUE_MSG_MAX];
+    };
+    QueueSlot txQueue[TX_QUEUE_SLOTS];
+    uint8_t txQueueHead;
+    uint8_t txQueueCount;
+    uint8_t txQueuePeakDepth;
+    uint32_t enqueuedCount;
+    uint32_t droppedBulkCount;
+    uint32_t droppedCriticalCount;
+    uint32_t lastLinkStats;
+    static bool isCriticalType(uint8_t msgType);
+    void drainQueueToBatch();
+    void sendLinkStats();
+
     // Internal helpers
     uint32_t getTimestamp() const { return millis(); }
     void sendMessage(const void* message, size_t size);
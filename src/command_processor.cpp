@@ -1,4 +1,5 @@
 #include "command_processor.h"
+#include "command_table.h"
 #include "subsystem_timing_monitor.h"
 #include "config_manager.h"
 #include "pressure_sensor.h"
@@ -8,11 +9,18 @@
 #include "safety_system.h"
 #include "system_error_manager.h"
 #include "input_manager.h"
+#include "memory_monitor.h"
+#include "flight_recorder.h"
+#include "response_streamer.h"
+#include "scratch_arena.h"
+#include "status_cache.h"
+#include "telemetry_manager.h"
 #include "command_processor.h"
 #include "arduino_secrets.h"
 #include "logger.h"
 #include "constants.h"
 #include <ctype.h>
+#include <EEPROM.h>
 
 // For system reset functionality on Arduino UNO R4 WiFi
 #ifdef ARDUINO_ARCH_RENESAS_UNO
@@ -41,19 +49,15 @@ static const unsigned long COMMAND_RATE_LIMIT_MS = 50; // 20 commands/second max
 
 bool CommandValidator::isValidCommand(const char* cmd) {
     if (!cmd || strlen(cmd) == 0 || strlen(cmd) > MAX_CMD_LENGTH) return false;
-    
+
     // Allow shorthand relay commands like "R1 ON" without leading 'relay'
     if ((cmd[0] == 'R' || cmd[0] == 'r') && isdigit((unsigned char)cmd[1])) {
         return true;
     }
 
-    // Check against whitelist
-    for (int i = 0; ALLOWED_COMMANDS[i] != nullptr; i++) {
-        if (strcasecmp(cmd, ALLOWED_COMMANDS[i]) == 0) {
-            return true;
-        }
-    }
-    return false;
+    // Same hashed table that processCommand() dispatches through, so the
+    // whitelist and the dispatch logic can't drift apart
+    return findCommand(cmd) != CommandId::CMD_UNKNOWN;
 }
 
 bool CommandValidator::isValidSetParam(const char* param) {
@@ -165,53 +169,87 @@ bool CommandValidator::checkRateLimit() {
 // ============================================================================
 
 void CommandProcessor::handleHelp(char* response, size_t responseSize, bool fromMqtt) {
-    const char* helpText = "Commands: help, show, debug, reset, error, loglevel [0-7], timing [report|reset|status|slowest|log], bypass";
+    const char* helpText = "Commands: help, show, debug, reset, error, loglevel [0-7], timing [report|reset|status|slowest|log], bypass, profile save|load|list";
+
+    // Serial replies stream out chunk-by-chunk from loop() passes instead of
+    // blocking on Serial.print; MQTT still needs the buffered single response
+    if (responseStreamer && !fromMqtt) {
+        responseStreamer->printf("Response: %s", helpText);
+        responseStreamer->write(", pins, pin <6|7> debounce <low|med|high>, set <param> <val>, relay R<n> ON|OFF\r\n");
+        responseStreamer->write("\r\nTiming Commands:\r\n");
+        responseStreamer->write("timing report - Show subsystem performance\r\n");
+        responseStreamer->write("timing status - Health status\r\n");
+        responseStreamer->write("timing slowest - Show bottleneck\r\n");
+        response[0] = '\0';
+        return;
+    }
+
     snprintf(response, responseSize, "%s, pins, pin <6|7> debounce <low|med|high>, set <param> <val>, relay R<n> ON|OFF\n\nTiming Commands:\ntiming report - Show subsystem performance\ntiming status - Health status\ntiming slowest - Show bottleneck", helpText);
 }
 
-void CommandProcessor::handleShow(char* response, size_t responseSize, bool fromMqtt) {
-    // Build compact status line in stable key=value groups.
-    // Order is intentionally fixed for downstream parsers: pressures, sequence, relays, safety.
-    // Example:
-    //   hydraulic=1234.5 hydraulic_oil=1180.2 seq=IDLE stage=NONE relays=1:ON,2:OFF safe=OK
-    char pressureStatus[96] = "";   // Increased for longer pressure readings
-    char sequenceStatus[80] = "";   // Increased for sequence info
-    char relayStatus[80] = "";      // Increased for relay status  
-    char safetyStatus[48] = "";     // Increased for safety status
-    
-    if (pressureManager) {
-        pressureManager->getStatusString(pressureStatus, sizeof(pressureStatus));
-        // Debug: Check if pressure status is empty
-        if (strlen(pressureStatus) == 0) {
-            snprintf(pressureStatus, sizeof(pressureStatus), "pressure=NONE");
-        }
-    } else if (pressureSensor) {
-        pressureSensor->getStatusString(pressureStatus, sizeof(pressureStatus));
-    } else {
-        snprintf(pressureStatus, sizeof(pressureStatus), "pressure=NO_MANAGER");
-    }
-    
-    if (sequenceController) {
-        sequenceController->getStatusString(sequenceStatus, sizeof(sequenceStatus));
+void CommandProcessor::handleShow(char* param, char* response, size_t responseSize, bool fromMqtt) {
+    // Optional subsystem selector: "show memory" reports the memory
+    // instrumentation instead of the machine status line
+    if (param && strcasecmp(param, "memory") == 0) {
+        if (memoryMonitor) {
+            memoryMonitor->getStatusString(response, responseSize);
+            // Scratch arena health rides along (in-use count includes the
+            // slot holding this very response on the serial path)
+            size_t used = strlen(response);
+            snprintf(response + used, responseSize - used,
+                     " scratch=%u/%u peak=%u overflow=%lu",
+                     scratchArena.slotsInUse(), SCRATCH_SLOT_COUNT,
+                     scratchArena.getPeakInUse(),
+                     (unsigned long)scratchArena.getOverflowCount());
+        } else {
+            snprintf(response, responseSize, "memory monitor not available");
+        }
+        return;
     }
-    
-    if (relayController) {
-        relayController->getStatusString(relayStatus, sizeof(relayStatus));
+
+    // "show loopstats" reports the loop jitter histogram summary
+    if (param && strcasecmp(param, "loopstats") == 0) {
+        if (timingMonitor) {
+            timingMonitor->getLoopStatsString(response, responseSize);
+        } else {
+            snprintf(response, responseSize, "timing monitor not available");
+        }
+        return;
     }
-    
-    if (safetySystem) {
-        safetySystem->getStatusString(safetyStatus, sizeof(safetyStatus));
+
+    // "show cycles" reports per-stage split cycle timing statistics
+    if (param && strcasecmp(param, "cycles") == 0) {
+        if (sequenceController) {
+            sequenceController->getCycleStatsString(response, responseSize);
+        } else {
+            snprintf(response, responseSize, "sequence controller not available");
+        }
+        return;
     }
-    
-    char errorStatus[32] = "errors=0";
-    if (systemErrorManager) {
-        int errorCount = systemErrorManager->getActiveErrorCount();
-        const char* ledPattern = systemErrorManager->getCurrentLedPatternString();
-        snprintf(errorStatus, sizeof(errorStatus), "errors=%d led=%s", errorCount, ledPattern);
+
+    // Status line comes from the preformatted section cache - subsystems
+    // mark their section dirty on state change and a scheduled step keeps
+    // the buffers current, so a "show" no longer walks five float-heavy
+    // getStatusString() chains while the loop waits.
+    // Order is intentionally fixed for downstream parsers: pressures, sequence, relays, safety.
+    // Example:
+    //   hydraulic=1234.5 hydraulic_oil=1180.2 seq=IDLE stage=NONE relays=1:ON,2:OFF safe=OK
+
+    // Serial path: stream the sections piecewise so the full status is no
+    // longer squeezed through (and truncated by) one SHARED_BUFFER_SIZE
+    // aggregate. Same single-line key=value format for downstream parsers.
+    if (responseStreamer && !fromMqtt) {
+        responseStreamer->write("Response: ");
+        for (uint8_t s = 0; s < STATUS_SECTION_COUNT; s++) {
+            if (s > 0) responseStreamer->write(" ");
+            responseStreamer->write(statusCache.getSection((StatusSection)s));
+        }
+        responseStreamer->write("\r\n");
+        response[0] = '\0';
+        return;
     }
-    
-    snprintf(response, responseSize, "%s %s %s %s %s", 
-        pressureStatus, sequenceStatus, relayStatus, safetyStatus, errorStatus);
+
+    statusCache.getStatusLine(response, responseSize);
 }
 
 void CommandProcessor::handlePins(char* response, size_t responseSize, bool fromMqtt) {
@@ -435,14 +473,78 @@ void CommandProcessor::handleSet(char* param, char* value, char* response, size_
         FilterMode mode = FILTER_NONE;
         if (strcasecmp(value, "median3") == 0) mode = FILTER_MEDIAN3;
         else if (strcasecmp(value, "ema") == 0) mode = FILTER_EMA;
-        
+        else if (strcasecmp(value, "mediann") == 0 || strcasecmp(value, "median") == 0) mode = FILTER_MEDIAN_N;
+
         if (pressureSensor) pressureSensor->setFilterMode(mode);
+        if (pressureManager) {
+            for (int i = 0; i < SENSOR_COUNT; i++) {
+                pressureManager->getSensor((PressureSensorType)i).setFilterMode(mode);
+            }
+        }
         if (configManager) {
             configManager->loadFromPressureSensor(*pressureSensor);
             configManager->save();
         }
         snprintf(response, responseSize, "filter set %s", value);
     }
+    else if (strcasecmp(param, "medianwindow") == 0) {
+        unsigned long val = strtoul(value, NULL, 10);
+        if (val >= MEDIAN_WINDOW_MIN && val <= MEDIAN_WINDOW_MAX) {
+            if (pressureSensor) pressureSensor->setMedianWindow((size_t)val);
+            if (pressureManager) {
+                for (int i = 0; i < SENSOR_COUNT; i++) {
+                    pressureManager->getSensor((PressureSensorType)i).setMedianWindow((size_t)val);
+                }
+            }
+            if (configManager) {
+                configManager->setMedianWindow((uint8_t)val);
+                configManager->save();
+            }
+            snprintf(response, responseSize, "medianWindow set %lu", val);
+        } else {
+            snprintf(response, responseSize, "medianWindow must be between %u and %u",
+                (unsigned)MEDIAN_WINDOW_MIN, (unsigned)MEDIAN_WINDOW_MAX);
+        }
+    }
+    else if (strcasecmp(param, "pubdeadband") == 0) {
+        float val = atof(value);
+        if (val >= 0.0f && val <= 1000.0f) {
+            if (pressureManager) pressureManager->setPublishDeadband(val);
+            if (configManager) {
+                configManager->setPubDeadband(val);
+                configManager->save();
+            }
+            snprintf(response, responseSize, "pubDeadband set %.1f PSI", val);
+        } else {
+            snprintf(response, responseSize, "pubDeadband must be 0-1000 PSI");
+        }
+    }
+    else if (strcasecmp(param, "pubrate") == 0) {
+        unsigned long val = strtoul(value, NULL, 10);
+        if (val >= 5 && val <= 5000) {
+            if (pressureManager) pressureManager->setPublishMinInterval(val);
+            if (configManager) {
+                configManager->setPubMinInterval((uint16_t)val);
+                configManager->save();
+            }
+            snprintf(response, responseSize, "pubRate min interval set %lums", val);
+        } else {
+            snprintf(response, responseSize, "pubRate must be 5-5000 ms");
+        }
+    }
+    else if (strcasecmp(param, "pubkeepalive") == 0) {
+        unsigned long val = strtoul(value, NULL, 10);
+        if (val >= 1000 && val <= 65535) {
+            if (pressureManager) pressureManager->setPublishKeepalive(val);
+            if (configManager) {
+                configManager->setPubKeepalive((uint16_t)val);
+                configManager->save();
+            }
+            snprintf(response, responseSize, "pubKeepalive set %lums", val);
+        } else {
+            snprintf(response, responseSize, "pubKeepalive must be 1000-65535 ms");
+        }
+    }
     else if (strcasecmp(param, "seqstable") == 0) {
         unsigned long val = strtoul(value, NULL, 10);
         if (sequenceController) sequenceController->setStableTime(val);
@@ -739,10 +841,10 @@ void CommandProcessor::handleError(char* param, char* value, char* response, siz
     }
     
     if (!param) {
-        snprintf(response, responseSize, "usage: error list|ack <code>|clear");
+        snprintf(response, responseSize, "usage: error list|stats|ack <code>|clear");
         return;
     }
-    
+
     if (strcasecmp(param, "list") == 0) {
         if (systemErrorManager->hasErrors()) {
             systemErrorManager->listActiveErrors(response, responseSize);
@@ -750,6 +852,11 @@ void CommandProcessor::handleError(char* param, char* value, char* response, siz
             snprintf(response, responseSize, "no active errors");
         }
     }
+    else if (strcasecmp(param, "stats") == 0) {
+        // Per-code occurrence counters and first/last timing - one line
+        // per code ever seen, not one entry per occurrence
+        systemErrorManager->getErrorStatsString(response, responseSize);
+    }
     else if (strcasecmp(param, "ack") == 0) {
         if (!value) {
             snprintf(response, responseSize, "usage: error ack <error_code>");
@@ -786,6 +893,67 @@ void CommandProcessor::handleError(char* param, char* value, char* response, siz
     }
 }
 
+void CommandProcessor::handleProfile(char* param, char* value, char* name, char* response, size_t responseSize) {
+    if (!configManager) {
+        snprintf(response, responseSize, "config manager not available");
+        return;
+    }
+
+    if (!param || strcasecmp(param, "list") == 0) {
+        size_t used = snprintf(response, responseSize, "profiles:");
+        for (uint8_t s = 0; s < PROFILE_SLOT_COUNT && used < responseSize; s++) {
+            char bankName[PROFILE_NAME_LEN];
+            if (configManager->profileGetName(s, bankName, sizeof(bankName))) {
+                used += snprintf(response + used, responseSize - used, " %u=%s", s, bankName);
+            } else {
+                used += snprintf(response + used, responseSize - used, " %u=<empty>", s);
+            }
+        }
+        return;
+    }
+
+    if (strcasecmp(param, "save") == 0) {
+        if (!value || !name) {
+            snprintf(response, responseSize, "usage: profile save <0-%u> <name>", PROFILE_SLOT_COUNT - 1);
+            return;
+        }
+        uint8_t slot = (uint8_t)atoi(value);
+        if (configManager->profileSave(slot, name)) {
+            // Journaled write commits in the background, CRC last
+            snprintf(response, responseSize, "profile %u '%s' saving", slot, name);
+        } else {
+            snprintf(response, responseSize, "profile save failed (slot 0-%u)", PROFILE_SLOT_COUNT - 1);
+        }
+        return;
+    }
+
+    if (strcasecmp(param, "load") == 0) {
+        if (!value) {
+            snprintf(response, responseSize, "usage: profile load <0-%u>", PROFILE_SLOT_COUNT - 1);
+            return;
+        }
+        uint8_t slot = (uint8_t)atoi(value);
+        char bankName[PROFILE_NAME_LEN] = "";
+        configManager->profileGetName(slot, bankName, sizeof(bankName));
+
+        if (!configManager->profileLoad(slot)) {
+            snprintf(response, responseSize, "profile %u empty or invalid", slot);
+            return;
+        }
+
+        // Hot-apply through the existing paths - no reboot needed
+        if (pressureManager) configManager->applyToPressureManager(*pressureManager);
+        if (sequenceController) configManager->applyToSequenceController(*sequenceController);
+        if (relayController) configManager->applyToRelayController(*relayController);
+        configManager->applyToLogger();
+
+        snprintf(response, responseSize, "profile %u '%s' loaded and applied", slot, bankName);
+        return;
+    }
+
+    snprintf(response, responseSize, "usage: profile save|load|list");
+}
+
 bool CommandProcessor::processCommand(char* commandBuffer, bool fromMqtt, char* response, size_t responseSize) {
     // Initialize response
     response[0] = '\0';
@@ -822,24 +990,8 @@ bool CommandProcessor::processCommand(char* commandBuffer, bool fromMqtt, char*
         return false;
     }
     
-    // Handle specific commands
-    if (strcasecmp(cmd, "help") == 0) {
-        handleHelp(response, responseSize, fromMqtt);
-    }
-    else if (strcasecmp(cmd, "show") == 0) {
-        handleShow(response, responseSize, fromMqtt);
-    }
-    else if (strcasecmp(cmd, "pins") == 0) {
-        handlePins(response, responseSize, fromMqtt);
-    }
-    else if (strcasecmp(cmd, "pin") == 0) {
-        char* param1 = strtok(NULL, " ");
-        char* param2 = strtok(NULL, " ");
-        char* param3 = strtok(NULL, " ");
-        handlePin(param1, param2, param3, response, responseSize);
-    }
     // Support shorthand relay control: "R1 ON" style (works for both Serial & MQTT)
-    else if ((cmd[0] == 'R' || cmd[0] == 'r') && cmd[1] && (cmd[1] >= '0' && cmd[1] <= '9')) {
+    if ((cmd[0] == 'R' || cmd[0] == 'r') && cmd[1] && (cmd[1] >= '0' && cmd[1] <= '9')) {
         char* stateToken = strtok(NULL, " ");
         if (!stateToken) {
             snprintf(response, responseSize, "usage: R<n> ON|OFF");
@@ -853,58 +1005,104 @@ bool CommandProcessor::processCommand(char* commandBuffer, bool fromMqtt, char*
             return false;
         }
     }
-    else if (strcasecmp(cmd, "set") == 0) {
-        char* param = strtok(NULL, " ");
-        char* value = strtok(NULL, " ");
-        
-        if (CommandValidator::validateSetCommand(param, value)) {
-            handleSet(param, value, response, responseSize);
-        } else {
-            snprintf(response, responseSize, "invalid set command");
+
+    // O(1)-flat dispatch: the token resolves through the hashed command
+    // table once, instead of a strcasecmp cascade
+    switch (findCommand(cmd)) {
+        case CommandId::CMD_HELP:
+            handleHelp(response, responseSize, fromMqtt);
+            break;
+        case CommandId::CMD_SHOW: {
+            char* param = strtok(NULL, " ");
+            handleShow(param, response, responseSize, fromMqtt);
+            break;
         }
-    }
-    else if (strcasecmp(cmd, "relay") == 0) {
-        char* relayToken = strtok(NULL, " ");
-        char* stateToken = strtok(NULL, " ");
-        
-        if (CommandValidator::validateRelayCommand(relayToken, stateToken)) {
-            handleRelay(relayToken, stateToken, response, responseSize);
-        } else {
-            snprintf(response, responseSize, "invalid relay command");
+        case CommandId::CMD_PINS:
+            handlePins(response, responseSize, fromMqtt);
+            break;
+        case CommandId::CMD_DUMP:
+            // Stream the flight recorder history over telemetry
+            flightRecorder.dump("command");
+            flightRecorder.getStatusString(response, responseSize);
+            break;
+        case CommandId::CMD_PIN: {
+            char* param1 = strtok(NULL, " ");
+            char* param2 = strtok(NULL, " ");
+            char* param3 = strtok(NULL, " ");
+            handlePin(param1, param2, param3, response, responseSize);
+            break;
         }
+        case CommandId::CMD_SET: {
+            char* param = strtok(NULL, " ");
+            char* value = strtok(NULL, " ");
+            if (CommandValidator::validateSetCommand(param, value)) {
+                handleSet(param, value, response, responseSize);
+            } else {
+                snprintf(response, responseSize, "invalid set command");
+            }
+            break;
+        }
+        case CommandId::CMD_RELAY: {
+            char* relayToken = strtok(NULL, " ");
+            char* stateToken = strtok(NULL, " ");
+            if (CommandValidator::validateRelayCommand(relayToken, stateToken)) {
+                handleRelay(relayToken, stateToken, response, responseSize);
+            } else {
+                snprintf(response, responseSize, "invalid relay command");
+            }
+            break;
+        }
+        case CommandId::CMD_DEBUG: {
+            char* param = strtok(NULL, " ");
+            handleDebug(param, response, responseSize);
+            break;
+        }
+        // Network command removed - non-networking version
+        case CommandId::CMD_BYPASS: {
+            char* param = strtok(NULL, " ");
+            handleBypass(param, response, responseSize);
+            break;
+        }
+        case CommandId::CMD_RESET: {
+            char* param = strtok(NULL, " ");
+            handleReset(param, response, responseSize);
+            break;
+        }
+        case CommandId::CMD_ERROR: {
+            char* param = strtok(NULL, " ");
+            char* value = strtok(NULL, " ");
+            handleError(param, value, response, responseSize);
+            break;
+        }
+        // Syslog and MQTT commands removed - non-networking version
+        case CommandId::CMD_LOGLEVEL: {
+            char* param = strtok(NULL, " ");
+            handleLogLevel(param, response, responseSize);
+            break;
+        }
+        case CommandId::CMD_TIMING: {
+            char* param = strtok(NULL, " ");
+            handleTiming(param, response, responseSize);
+            break;
+        }
+        case CommandId::CMD_BENCH: {
+            char* param = strtok(NULL, " ");
+            handleBench(param, response, responseSize);
+            break;
+        }
+        case CommandId::CMD_PROFILE: {
+            char* param = strtok(NULL, " ");
+            char* value = strtok(NULL, " ");
+            char* name = strtok(NULL, " ");
+            handleProfile(param, value, name, response, responseSize);
+            break;
+        }
+        default:
+            // Covers CMD_UNKNOWN plus reserved tokens with no handler yet
+            snprintf(response, responseSize, "unknown command: %s", cmd);
+            return false;
     }
-    else if (strcasecmp(cmd, "debug") == 0) {
-        char* param = strtok(NULL, " ");
-        handleDebug(param, response, responseSize);
-    }
-    // Network command removed - non-networking version
-    else if (strcasecmp(cmd, "bypass") == 0) {
-        char* param = strtok(NULL, " ");
-        handleBypass(param, response, responseSize);
-    }
-    else if (strcasecmp(cmd, "reset") == 0) {
-        char* param = strtok(NULL, " ");
-        handleReset(param, response, responseSize);
-    }
-    else if (strcasecmp(cmd, "error") == 0) {
-        char* param = strtok(NULL, " ");
-        char* value = strtok(NULL, " ");
-        handleError(param, value, response, responseSize);
-    }
-    // Syslog and MQTT commands removed - non-networking version
-    else if (strcasecmp(cmd, "loglevel") == 0) {
-        char* param = strtok(NULL, " ");
-        handleLogLevel(param, response, responseSize);
-    }
-    else if (strcasecmp(cmd, "timing") == 0) {
-        char* param = strtok(NULL, " ");
-        handleTiming(param, response, responseSize);
-    }
-    else {
-        snprintf(response, responseSize, "unknown command: %s", cmd);
-        return false;
-    }
-    
+
     return true;
 }
 
@@ -1015,7 +1213,201 @@ void CommandProcessor::handleTiming(char* param, char* response, size_t response
             snprintf(response, responseSize, "usage: timing detailed <on|off>");
         }
     }
+    else if (strcasecmp(param, "outlier") == 0) {
+        // Loop jitter outlier threshold: passes longer than this get an
+        // attribution snapshot (see "show loopstats")
+        char* msParam = strtok(NULL, " ");
+        if (msParam) {
+            unsigned long ms = strtoul(msParam, NULL, 10);
+            if (ms >= 1 && ms <= 10000) {
+                timingMonitor->setLoopOutlierThreshold(ms * 1000UL);
+                snprintf(response, responseSize, "loop outlier threshold set to %lums", ms);
+            } else {
+                snprintf(response, responseSize, "outlier threshold must be 1-10000 ms");
+            }
+        } else {
+            snprintf(response, responseSize, "loop outlier threshold: %lums (usage: timing outlier <ms>)",
+                     timingMonitor->getLoopOutlierThresholdUs() / 1000UL);
+        }
+    }
     else {
-        snprintf(response, responseSize, "timing commands: report, reset, status, slowest, log, detailed");
+        snprintf(response, responseSize, "timing commands: report, reset, status, slowest, log, detailed, outlier");
     }
-}
\ No newline at end of file
+}
+
+// ============================================================================
+// On-Device Microbenchmarks ("bench" command family)
+// ============================================================================
+// Active, bounded measurements of the primitives the firmware is built on.
+// handleTiming() reports what the subsystems happened to cost; these answer
+// "what does one analogRead / EEPROM write / relay round-trip cost on this
+// board". Interrupts stay enabled throughout (noted in every result line) so
+// the numbers reflect real operating conditions, not best-case masked runs.
+
+static uint32_t benchNsPerOp(unsigned long elapsedUs, uint32_t iterations) {
+    return (uint32_t)(((uint64_t)elapsedUs * 1000ULL) / (uint64_t)iterations);
+}
+
+void CommandProcessor::handleBench(char* param, char* response, size_t responseSize) {
+    if (!param) {
+        snprintf(response, responseSize,
+                 "bench commands: adc, gpio, relay, eeprom, log, telemetry, all");
+        return;
+    }
+
+    if (strcasecmp(param, "all") == 0) {
+        // Serial-only: stream each result line as it completes
+        if (!responseStreamer) {
+            snprintf(response, responseSize, "bench all requires the serial path");
+            return;
+        }
+        const char* benches[] = { "adc", "gpio", "relay", "eeprom", "log", "telemetry" };
+        char sub[12];
+        for (size_t i = 0; i < sizeof(benches) / sizeof(benches[0]); i++) {
+            strncpy(sub, benches[i], sizeof(sub) - 1);
+            sub[sizeof(sub) - 1] = '\0';
+            handleBench(sub, response, responseSize);
+            responseStreamer->write(response);
+            responseStreamer->write("\r\n");
+        }
+        response[0] = '\0';
+        return;
+    }
+
+    if (strcasecmp(param, "adc") == 0) {
+        // Polled conversion cost per channel - the budget every sample in
+        // the 1 kHz ISR pays
+        const uint32_t N = 1000;
+        volatile int sink = 0;
+        unsigned long t0 = micros();
+        for (uint32_t i = 0; i < N; i++) sink += analogRead(HYDRAULIC_PRESSURE_PIN);
+        unsigned long a1Us = micros() - t0;
+        t0 = micros();
+        for (uint32_t i = 0; i < N; i++) sink += analogRead(HYDRAULIC_OIL_PRESSURE_PIN);
+        unsigned long a5Us = micros() - t0;
+        (void)sink;
+        snprintf(response, responseSize,
+                 "bench adc: A1=%luns/op A5=%luns/op n=%lu irq=on",
+                 (unsigned long)benchNsPerOp(a1Us, N),
+                 (unsigned long)benchNsPerOp(a5Us, N), (unsigned long)N);
+        return;
+    }
+
+    if (strcasecmp(param, "gpio") == 0) {
+        // digitalRead() through the pin-mux abstraction vs the direct PIDR
+        // read InputManager's port snapshots use
+        const uint32_t N = 10000;
+        volatile int sink = 0;
+        unsigned long t0 = micros();
+        for (uint32_t i = 0; i < N; i++) sink += digitalRead(E_STOP_PIN);
+        unsigned long coreUs = micros() - t0;
+
+#ifdef ARDUINO_ARCH_RENESAS_UNO
+        bsp_io_port_pin_t bspPin = digitalPinToBspPin(E_STOP_PIN);
+        uint8_t port = (uint8_t)((bspPin >> 8) & 0x0F);
+        uint8_t bit = (uint8_t)(bspPin & 0x0F);
+        volatile const uint16_t* pidr =
+            &(((R_PORT0_Type*)(R_PORT0_BASE + (uint32_t)port * 0x20UL))->PIDR);
+        t0 = micros();
+        for (uint32_t i = 0; i < N; i++) sink += (int)((*pidr >> bit) & 1u);
+        unsigned long portUs = micros() - t0;
+        snprintf(response, responseSize,
+                 "bench gpio: digitalRead=%luns/op portRead=%luns/op n=%lu irq=on",
+                 (unsigned long)benchNsPerOp(coreUs, N),
+                 (unsigned long)benchNsPerOp(portUs, N), (unsigned long)N);
+#else
+        snprintf(response, responseSize,
+                 "bench gpio: digitalRead=%luns/op portRead=n/a n=%lu irq=on",
+                 (unsigned long)benchNsPerOp(coreUs, N), (unsigned long)N);
+#endif
+        (void)sink;
+        return;
+    }
+
+    if (strcasecmp(param, "relay") == 0) {
+        if (!relayController) {
+            snprintf(response, responseSize, "relay controller not available");
+            return;
+        }
+        if (!relayController->isPipelineIdle()) {
+            snprintf(response, responseSize, "bench relay: pipeline busy - retry");
+            return;
+        }
+        // Force-resend an unused relay's current state so nothing moves;
+        // setRelay()'s already-in-state dedup would swallow the command,
+        // so this goes through the resend path to measure the full
+        // enqueue -> wire -> "OK" response round-trip
+        const uint8_t testRelay = 5;
+        unsigned long t0 = micros();
+        if (!relayController->resendRelayState(testRelay)) {
+            snprintf(response, responseSize, "bench relay: enqueue failed");
+            return;
+        }
+        unsigned long deadline = millis() + 500;
+        while (!relayController->isPipelineIdle() && (long)(deadline - millis()) > 0) {
+            relayController->update();
+        }
+        unsigned long rtUs = micros() - t0;
+        snprintf(response, responseSize,
+                 "bench relay: roundtrip=%luus (R%u re-commanded, %s) irq=on",
+                 rtUs, testRelay,
+                 relayController->isPipelineIdle() ? "confirmed" : "TIMEOUT");
+        return;
+    }
+
+    if (strcasecmp(param, "eeprom") == 0) {
+        // Force real cell writes by alternating values at a scratch address
+        // well past the calibration block, then restore the original byte.
+        // Kept to 16 writes - flash-emulated EEPROM writes are ms-scale.
+        const uint32_t N = 16;
+        const int scratchAddr = 1000;
+        uint8_t original = EEPROM.read(scratchAddr);
+        unsigned long t0 = micros();
+        for (uint32_t i = 0; i < N; i++) {
+            EEPROM.write(scratchAddr, (i & 1) ? 0xA5 : 0x5A);
+        }
+        unsigned long writeUs = micros() - t0;
+        EEPROM.write(scratchAddr, original);
+        snprintf(response, responseSize,
+                 "bench eeprom: write=%luus/op n=%lu addr=%d irq=on",
+                 writeUs / N, (unsigned long)N, scratchAddr);
+        return;
+    }
+
+    if (strcasecmp(param, "log") == 0) {
+        // Cost of a DEBUG-level call site under the current logger settings;
+        // with the default INFO level this measures the filter/early-out
+        // path, with DEBUG enabled it measures format (or deferred enqueue)
+        const uint32_t N = 1000;
+        bool filtered = Logger::getLogLevel() < LOG_DEBUG;
+        unsigned long t0 = micros();
+        for (uint32_t i = 0; i < N; i++) {
+            Logger::logDebug("bench log %lu", (unsigned long)i);
+        }
+        unsigned long logUs = micros() - t0;
+        snprintf(response, responseSize,
+                 "bench log: logDebug=%luns/op n=%lu %s deferred=%s irq=on",
+                 (unsigned long)benchNsPerOp(logUs, N), (unsigned long)N,
+                 filtered ? "(level-filtered)" : "(formatted)",
+                 Logger::isDeferredLogging() ? "on" : "off");
+        return;
+    }
+
+    if (strcasecmp(param, "telemetry") == 0) {
+        // Batch append + framing cost per status message; the TX ring
+        // absorbs the burst and drains from the scheduler afterwards
+        const uint32_t N = 100;
+        unsigned long t0 = micros();
+        for (uint32_t i = 0; i < N; i++) {
+            telemetryManager.sendSystemStatus();
+        }
+        unsigned long sendUs = micros() - t0;
+        snprintf(response, responseSize,
+                 "bench telemetry: sendSystemStatus=%luns/op n=%lu irq=on",
+                 (unsigned long)benchNsPerOp(sendUs, N), (unsigned long)N);
+        return;
+    }
+
+    snprintf(response, responseSize,
+             "bench commands: adc, gpio, relay, eeprom, log, telemetry, all");
+}
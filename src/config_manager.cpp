@@ -80,8 +80,14 @@ bool ConfigManager::isValidConfig(const CalibrationData& data) {
     if (data.adcVref <= 0.0f || data.adcVref > 5.0f) return false;
     if (data.maxPressurePsi <= 0.0f || data.maxPressurePsi > 10000.0f) return false;
     if (data.sensorGain <= 0.0f || data.sensorGain > 100.0f) return false;
-    if (data.filterMode > 2) return false;
+    if (data.filterMode > 3) return false;
     if (data.emaAlpha <= 0.0f || data.emaAlpha > 1.0f) return false;
+    if (data.medianWindow < MEDIAN_WINDOW_MIN || data.medianWindow > MEDIAN_WINDOW_MAX) return false;
+    if (data.pubDeadbandPsi < 0.0f || data.pubDeadbandPsi > 1000.0f) return false;
+    if (data.pubMinIntervalMs < 5 || data.pubMinIntervalMs > 5000) return false;
+    if (data.pubKeepaliveMs < 1000) return false;
+    if (data.overpressureCeilingPsi != 0.0f &&
+        (data.overpressureCeilingPsi < 1000.0f || data.overpressureCeilingPsi > 10000.0f)) return false;
     
     // Validate individual sensor parameters - A1 (System Pressure)
     if (data.a1_adcVref <= 0.0f || data.a1_adcVref > 5.0f) return false;
@@ -111,6 +117,11 @@ void ConfigManager::setDefaults() {
     config.sensorOffset = DEFAULT_SENSOR_OFFSET;
     config.filterMode = (uint8_t)FILTER_MEDIAN3;
     config.emaAlpha = 0.2f;
+    config.medianWindow = (uint8_t)DEFAULT_MEDIAN_WINDOW;
+    config.pubDeadbandPsi = 10.0f;   // Adaptive publisher: movement that triggers a send
+    config.pubMinIntervalMs = 25;    // Fastest change-driven rate (pressure task cadence)
+    config.pubKeepaliveMs = 10000;   // Static-value fallback (old fixed interval)
+    config.overpressureCeilingPsi = DEFAULT_OVERPRESSURE_CEILING_PSI;
     config.pinModesBitmap = 0; // All pins default to NO (normally open)
     config.seqStableMs = DEFAULT_SEQUENCE_STABLE_MS;
     config.seqStartStableMs = DEFAULT_SEQUENCE_START_STABLE_MS;
@@ -153,6 +164,7 @@ void ConfigManager::begin() {
         Serial.println("ConfigManager: EEPROM validation failed - loading defaults and saving");
         setDefaults();
         if (save()) {
+            flushSave();  // Init path - complete the save before continuing
             Serial.println("ConfigManager: Default configuration saved to EEPROM with CRC32");
         } else {
             Serial.println("ConfigManager: WARNING - Failed to save defaults to EEPROM");
@@ -204,7 +216,7 @@ bool ConfigManager::save() {
         Serial.println("ConfigManager: Cannot save invalid configuration");
         return false;
     }
-    
+
     // Pack pin modes into bitmap
     config.pinModesBitmap = 0;
     for (size_t i = 0; i < WATCH_PIN_COUNT && i < 8; i++) {
@@ -212,16 +224,133 @@ bool ConfigManager::save() {
             config.pinModesBitmap |= (1 << i);
         }
     }
-    
+
     // Calculate and update CRC32 before saving
     updateCRC(config);
-    
-    EEPROM.put(CALIB_EEPROM_ADDR, config);
-    
-    Serial.println("ConfigManager: Configuration saved to EEPROM with CRC32 verification");
-    
+
+    // A journal in flight for a different region (a profile bank) must
+    // finish before the writer is retargeted, or that region is left
+    // half-written with a stale CRC
+    if (saveInProgress && saveAddr != CALIB_EEPROM_ADDR) {
+        flushSave();
+    }
+
+    // Snapshot the image and let update() commit it in the background.
+    // EEPROM.put() of the whole struct blocked for tens of milliseconds on
+    // the R4's flash-emulated EEPROM - long enough to miss limit-switch
+    // edges while an operator tunes parameters.
+    memcpy(pendingImage, &config, sizeof(CalibrationData));
+    saveAddr = CALIB_EEPROM_ADDR;
+    saveLength = sizeof(CalibrationData);
+    saveOffset = 0;  // (Re)start - a same-target save in flight picks up the new image
+    saveInProgress = true;
+
     // Network publishing removed - non-networking version
-    
+
+    return true;
+}
+
+void ConfigManager::update() {
+    if (!saveInProgress) return;
+
+    // Commit a small chunk per pass, skipping bytes that already match so
+    // a typical single-parameter save touches only a handful of cells.
+    // Linear order means crc32 (last field) is written last - it acts as
+    // the commit record for the whole save.
+    size_t end = saveOffset + SAVE_CHUNK_BYTES;
+    if (end > saveLength) end = saveLength;
+
+    for (; saveOffset < end; saveOffset++) {
+        int addr = saveAddr + (int)saveOffset;
+        if (EEPROM.read(addr) != pendingImage[saveOffset]) {
+            EEPROM.write(addr, pendingImage[saveOffset]);
+        }
+    }
+
+    if (saveOffset >= saveLength) {
+        saveInProgress = false;
+        Serial.println("ConfigManager: Configuration saved to EEPROM with CRC32 verification");
+    }
+}
+
+void ConfigManager::flushSave() {
+    // Synchronous completion for init paths where blocking is acceptable
+    while (saveInProgress) {
+        update();
+    }
+}
+
+static int profileSlotAddr(uint8_t slot) {
+    return PROFILE_EEPROM_BASE + (int)slot * PROFILE_EEPROM_STRIDE;
+}
+
+bool ConfigManager::profileSave(uint8_t slot, const char* name) {
+    if (slot >= PROFILE_SLOT_COUNT || !configValid) return false;
+    if (!name || !name[0]) return false;
+
+    // Finish any journal aimed at a different region first - retargeting
+    // mid-write would abandon the live config (or another bank) with a
+    // stale CRC, silently reverting it to defaults on the next boot
+    if (saveInProgress && saveAddr != profileSlotAddr(slot)) {
+        flushSave();
+    }
+
+    // Build the bank image: name line, then the current config with a
+    // fresh CRC. Committed through the same journaled writer as save(),
+    // so crc32 lands last and identical bytes are skipped.
+    ProfileSlot bank;
+    memset(bank.name, 0, sizeof(bank.name));
+    strncpy(bank.name, name, sizeof(bank.name) - 1);
+
+    config.pinModesBitmap = 0;
+    for (size_t i = 0; i < WATCH_PIN_COUNT && i < 8; i++) {
+        if (pinIsNC[i]) {
+            config.pinModesBitmap |= (1 << i);
+        }
+    }
+    updateCRC(config);
+    bank.data = config;
+
+    memcpy(pendingImage, &bank, sizeof(ProfileSlot));
+    saveAddr = profileSlotAddr(slot);
+    saveLength = sizeof(ProfileSlot);
+    saveOffset = 0;
+    saveInProgress = true;
+    return true;
+}
+
+bool ConfigManager::profileLoad(uint8_t slot) {
+    if (slot >= PROFILE_SLOT_COUNT) return false;
+    flushSave();  // Don't read a bank while the journal is mid-write
+
+    ProfileSlot bank;
+    EEPROM.get(profileSlotAddr(slot), bank);
+    if (bank.name[0] == '\0' || (uint8_t)bank.name[0] == 0xFF) return false;
+    if (!isValidConfig(bank.data)) return false;
+
+    config = bank.data;
+    configValid = true;
+
+    // Restore pin modes from bitmap
+    for (size_t i = 0; i < WATCH_PIN_COUNT; i++) {
+        pinIsNC[i] = (config.pinModesBitmap & (1 << i)) != 0;
+    }
+
+    // Persist as the live config so the selected profile survives a reboot
+    save();
+    return true;
+}
+
+bool ConfigManager::profileGetName(uint8_t slot, char* nameOut, size_t nameSize) {
+    if (slot >= PROFILE_SLOT_COUNT || nameSize == 0) return false;
+
+    ProfileSlot bank;
+    EEPROM.get(profileSlotAddr(slot), bank);
+    if (bank.name[0] == '\0' || (uint8_t)bank.name[0] == 0xFF) return false;
+    if (!isValidConfig(bank.data)) return false;
+
+    bank.name[sizeof(bank.name) - 1] = '\0';
+    snprintf(nameOut, nameSize, "%s", bank.name);
     return true;
 }
 
@@ -259,6 +388,7 @@ void ConfigManager::applyToPressureSensor(PressureSensor& sensor) {
     sensor.setMaxPressure(config.maxPressurePsi);
     sensor.setSensorGain(config.sensorGain);
     sensor.setSensorOffset(config.sensorOffset);
+    sensor.setMedianWindow(config.medianWindow);
     sensor.setFilterMode((FilterMode)config.filterMode);
     sensor.setEmaAlpha(config.emaAlpha);
 }
@@ -278,7 +408,23 @@ void ConfigManager::applyToPressureManager(class PressureManager& manager) {
     sensorA5.setAdcVref(config.a5_adcVref);
     sensorA5.setSensorGain(config.a5_sensorGain);
     sensorA5.setSensorOffset(config.a5_sensorOffset);
-    
+
+    // Filter settings are shared across channels
+    for (int i = 0; i < SENSOR_COUNT; i++) {
+        auto& channel = manager.getSensor((PressureSensorType)i);
+        channel.setMedianWindow(config.medianWindow);
+        channel.setFilterMode((FilterMode)config.filterMode);
+        channel.setEmaAlpha(config.emaAlpha);
+    }
+
+    // Adaptive publisher settings
+    manager.setPublishDeadband(config.pubDeadbandPsi);
+    manager.setPublishMinInterval(config.pubMinIntervalMs);
+    manager.setPublishKeepalive(config.pubKeepaliveMs);
+
+    // Raw overpressure comparator ceiling (refolds the counts threshold)
+    manager.setOverpressureCeiling(config.overpressureCeilingPsi);
+
     Serial.println("ConfigManager: Applied individual sensor configurations");
 }
 
@@ -328,6 +474,7 @@ void ConfigManager::loadFromPressureSensor(const PressureSensor& sensor) {
     config.sensorOffset = sensor.getSensorOffset();
     config.filterMode = (uint8_t)sensor.getFilterMode();
     config.emaAlpha = sensor.getEmaAlpha();
+    config.medianWindow = (uint8_t)sensor.getMedianWindow();
 }
 
 void ConfigManager::loadFromSequenceController(const SequenceController& controller) {
@@ -346,17 +493,20 @@ void ConfigManager::getStatusString(char* buffer, size_t bufferSize) {
         case 0: filterName = "none"; break;
         case 1: filterName = "median3"; break;
         case 2: filterName = "ema"; break;
+        case 3: filterName = "medianN"; break;
     }
-    
+
     snprintf(buffer, bufferSize,
-        "valid=%s adcVref=%.3f maxPsi=%.1f gain=%.3f offset=%.3f filter=%s emaAlpha=%.3f seqStable=%lu seqStart=%lu seqTimeout=%lu",
+        "valid=%s save=%s adcVref=%.3f maxPsi=%.1f gain=%.3f offset=%.3f filter=%s emaAlpha=%.3f medianWin=%u seqStable=%lu seqStart=%lu seqTimeout=%lu",
         configValid ? "yes" : "no",
+        saveInProgress ? "PENDING" : "idle",
         config.adcVref,
         config.maxPressurePsi,
         config.sensorGain,
         config.sensorOffset,
         filterName,
         config.emaAlpha,
+        (unsigned)config.medianWindow,
         (unsigned long)config.seqStableMs,
         (unsigned long)config.seqStartStableMs,
         (unsigned long)config.seqTimeoutMs
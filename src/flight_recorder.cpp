@@ -0,0 +1,49 @@
+#include "flight_recorder.h"
+#include "telemetry_manager.h"
+#include "hardware_watchdog.h"
+#include "logger.h"
+
+extern TelemetryManager telemetryManager;
+
+void FlightRecorder::dump(const char* reason) {
+    if (filled == 0) {
+        Serial.println("Flight recorder: no events recorded");
+        return;
+    }
+
+    Serial.print("Flight recorder dump (");
+    Serial.print(reason ? reason : "manual");
+    Serial.print("): ");
+    Serial.print((unsigned long)filled);
+    Serial.println(" records");
+    LOG_INFO("Flight recorder dump: %lu records (%lu total recorded)",
+        (unsigned long)filled, (unsigned long)totalRecords);
+
+    // Oldest record is at head when the ring has wrapped, at 0 otherwise
+    size_t index = (filled == RING_SIZE) ? head : 0;
+    for (size_t i = 0; i < filled; i++) {
+        const FlightRecord& r = records[index];
+        telemetryManager.sendFlightRecord(r.timestampUs, r.eventType, r.detail, r.value);
+        index = (index + 1) & (RING_SIZE - 1);
+
+        // Keep the TX ring from overflowing mid-dump - this is a fault
+        // path, blocking the loop is acceptable here. A full dump over a
+        // backpressured link can block for most of a second though, well
+        // past the 500 ms hardware watchdog window, so kick it alongside
+        // each flush - losing the dump to a watchdog reset would destroy
+        // exactly the evidence it exists to preserve.
+        if ((i & 0x07) == 0x07) {
+            HardwareWatchdog::kick();
+            telemetryManager.flushBlocking(50);
+        }
+    }
+    HardwareWatchdog::kick();
+    telemetryManager.flushBlocking(100);
+}
+
+void FlightRecorder::getStatusString(char* buffer, size_t bufferSize) {
+    snprintf(buffer, bufferSize, "records=%lu buffered=%lu size=%lu",
+        (unsigned long)totalRecords,
+        (unsigned long)filled,
+        (unsigned long)RING_SIZE);
+}
@@ -0,0 +1,56 @@
+#include "hardware_watchdog.h"
+
+#ifdef ARDUINO_ARCH_RENESAS_UNO
+#include <WDT.h>
+#endif
+
+// Breadcrumb lives in .noinit so the startup code does not zero it on a
+// watchdog reset; only a power cycle leaves it with random contents,
+// which the magic check catches.
+#ifdef ARDUINO_ARCH_RENESAS_UNO
+__attribute__((section(".noinit"))) WatchdogBreadcrumb g_watchdogBreadcrumb;
+#else
+WatchdogBreadcrumb g_watchdogBreadcrumb;
+#endif
+
+bool HardwareWatchdog::wdtResetDetected = false;
+uint8_t HardwareWatchdog::savedSubsystemId = 0xFF;
+
+bool HardwareWatchdog::begin(uint32_t timeoutMs) {
+#ifdef ARDUINO_ARCH_RENESAS_UNO
+    // RSTSR1: bit0 = IWDT reset, bit1 = WDT reset. Read the cause of the
+    // boot we are in, then clear the flags for the next one.
+    uint16_t resetStatus = R_SYSTEM->RSTSR1;
+    wdtResetDetected = (resetStatus & (R_SYSTEM_RSTSR1_IWDTRF_Msk | R_SYSTEM_RSTSR1_WDTRF_Msk)) != 0;
+    R_SYSTEM->RSTSR1 = 0;
+
+    // Breadcrumb is only meaningful if the reset came from the watchdog
+    // and the magic survived
+    if (wdtResetDetected && g_watchdogBreadcrumb.magic == BREADCRUMB_MAGIC) {
+        savedSubsystemId = g_watchdogBreadcrumb.subsystemId;
+    } else {
+        savedSubsystemId = 0xFF;
+    }
+    g_watchdogBreadcrumb.magic = BREADCRUMB_MAGIC;
+    g_watchdogBreadcrumb.subsystemId = 0xFF;
+
+    return WDT.begin(timeoutMs);
+#else
+    (void)timeoutMs;
+    return false;  // Non-Renesas build: soft health check only
+#endif
+}
+
+void HardwareWatchdog::kick() {
+#ifdef ARDUINO_ARCH_RENESAS_UNO
+    WDT.refresh();
+#endif
+}
+
+bool HardwareWatchdog::resetByWatchdog() {
+    return wdtResetDetected;
+}
+
+uint8_t HardwareWatchdog::lastSubsystemBeforeReset() {
+    return savedSubsystemId;
+}
@@ -3,6 +3,7 @@
 #include "config_manager.h"
 #include "logger.h"
 #include "telemetry_manager.h"
+#include "flight_recorder.h"
 
 // NetworkManager extern removed - non-networking version
 extern void debugPrintf(const char* fmt, ...);
@@ -11,6 +12,109 @@ extern TelemetryManager telemetryManager;
 // Forward declaration for helper function
 Telemetry::InputType getInputTypeFromPin(uint8_t pin);
 
+// ============================================================================
+// Limit-Switch Pin-Change ISR Capture (pins 6/7)
+// ============================================================================
+// Single-producer (ISR) / single-consumer (update()) ring buffer. Power-of-two
+// size so index wrap is a mask; head is only written by the ISRs, tail only by
+// update(), so no locking is required beyond the volatile indices.
+
+static const uint8_t ISR_EVENT_BUFFER_SIZE = 16;  // Must be power of two
+static const uint8_t ISR_EVENT_BUFFER_MASK = ISR_EVENT_BUFFER_SIZE - 1;
+
+static volatile InputEdgeEvent isrEventBuffer[ISR_EVENT_BUFFER_SIZE];
+static volatile uint8_t isrEventHead = 0;  // Written by ISR only
+static volatile uint8_t isrEventTail = 0;  // Written by update() only
+static volatile unsigned long isrEventCount = 0;
+static volatile unsigned long isrOverflowCount = 0;
+
+static void recordLimitEdge(uint8_t pin) {
+    uint8_t head = isrEventHead;
+    uint8_t next = (head + 1) & ISR_EVENT_BUFFER_MASK;
+
+    if (next == isrEventTail) {
+        // Buffer full - drop the edge, count it so update() can report
+        isrOverflowCount++;
+        return;
+    }
+
+    isrEventBuffer[head].pin = pin;
+    isrEventBuffer[head].rawLevel = (digitalRead(pin) == HIGH);
+    isrEventBuffer[head].timestampUs = micros();
+    isrEventHead = next;
+    isrEventCount++;
+}
+
+static void limitExtendIsr() {
+    recordLimitEdge(LIMIT_EXTEND_PIN);
+}
+
+static void limitRetractIsr() {
+    recordLimitEdge(LIMIT_RETRACT_PIN);
+}
+
+// ============================================================================
+// Direct-Port GPIO Snapshot (RA4M1)
+// ============================================================================
+// digitalRead() walks the pin-mux abstraction on every call; reading the PIDR
+// input register directly costs a couple of cycles and returns all 16 pins of
+// a port at once. The watched pins span only a few ports, so one snapshot per
+// update replaces eight digitalRead() calls and samples every pin at the same
+// instant (which also tightens the debounce math).
+
+void InputManager::buildPortSnapshotTable() {
+#ifdef ARDUINO_ARCH_RENESAS_UNO
+    snapshotPortCount = 0;
+
+    for (size_t i = 0; i < WATCH_PIN_COUNT; i++) {
+        bsp_io_port_pin_t bspPin = digitalPinToBspPin(WATCH_PINS[i]);
+        uint8_t port = (uint8_t)((bspPin >> 8) & 0x0F);
+        uint8_t bit = (uint8_t)(bspPin & 0x0F);
+
+        // RA4M1 port blocks are 0x20 bytes apart starting at R_PORT0
+        volatile const uint16_t* pidr =
+            &(((R_PORT0_Type*)(R_PORT0_BASE + (uint32_t)port * 0x20UL))->PIDR);
+
+        // Reuse an existing slot if this port is already in the table
+        size_t slot = snapshotPortCount;
+        for (size_t p = 0; p < snapshotPortCount; p++) {
+            if (snapshotPorts[p].pidr == pidr) {
+                slot = p;
+                break;
+            }
+        }
+        if (slot == snapshotPortCount) {
+            snapshotPorts[slot].pidr = pidr;
+            snapshotPorts[slot].value = 0;
+            snapshotPortCount++;
+        }
+
+        pinPortSlot[i] = (uint8_t)slot;
+        pinBitMask[i] = (uint16_t)(1U << bit);
+    }
+
+    portSnapshotEnabled = true;
+    LOG_INFO("INPUT: Port snapshot mode enabled (%u pins across %u port reads)",
+               (unsigned)WATCH_PIN_COUNT, (unsigned)snapshotPortCount);
+#else
+    // Non-Renesas build (e.g. native test shim): fall back to digitalRead()
+    portSnapshotEnabled = false;
+#endif
+}
+
+void InputManager::capturePortSnapshot() {
+    for (size_t p = 0; p < snapshotPortCount; p++) {
+        snapshotPorts[p].value = *snapshotPorts[p].pidr;
+    }
+}
+
+bool InputManager::readPinRawHigh(size_t index) {
+    if (portSnapshotEnabled) {
+        return (snapshotPorts[pinPortSlot[index]].value & pinBitMask[index]) != 0;
+    }
+    return digitalRead(WATCH_PINS[index]) == HIGH;
+}
+
 void InputManager::begin(ConfigManager* config) {
     configManager = config;
     
@@ -42,10 +146,80 @@ void InputManager::begin(ConfigManager* config) {
                    pinStates[i] ? "ACTIVE" : "INACTIVE");
     }
     
+    // Build the direct-port snapshot table now that pin modes are configured
+    buildPortSnapshotTable();
+
+    // Attach pin-change interrupts for the limit switches so fast cylinder
+    // edges are timestamped at the ISR instead of waiting for the next poll
+    attachInterrupt(digitalPinToInterrupt(LIMIT_EXTEND_PIN), limitExtendIsr, CHANGE);
+    attachInterrupt(digitalPinToInterrupt(LIMIT_RETRACT_PIN), limitRetractIsr, CHANGE);
+    LOG_INFO("INPUT: Limit switch ISR capture enabled on pins %d/%d",
+               LIMIT_EXTEND_PIN, LIMIT_RETRACT_PIN);
+
     LOG_INFO("INPUT: InputManager initialized");
     debugPrintf("InputManager initialized\n");
 }
 
+void InputManager::drainInterruptEvents() {
+    while (isrEventTail != isrEventHead) {
+        // Copy the event out before advancing tail (ISR only writes at head)
+        InputEdgeEvent event;
+        event.pin = isrEventBuffer[isrEventTail].pin;
+        event.rawLevel = isrEventBuffer[isrEventTail].rawLevel;
+        event.timestampUs = isrEventBuffer[isrEventTail].timestampUs;
+        isrEventTail = (isrEventTail + 1) & ISR_EVENT_BUFFER_MASK;
+
+        // Find the watched pin index for this event
+        for (size_t i = 0; i < WATCH_PIN_COUNT; i++) {
+            if (WATCH_PINS[i] != event.pin) continue;
+
+            // Map raw level to logical state according to NC/NO configuration
+            bool reading;
+            if (configManager && configManager->isPinNC(i)) {
+                reading = event.rawLevel;   // NC: active when HIGH (open)
+            } else {
+                reading = !event.rawLevel;  // NO: active when LOW (pullup)
+            }
+
+            if (reading != lastReadings[i]) {
+                // Anchor the debounce window in the millis() timebase the
+                // update() comparison uses - deriving it from the micros()
+                // ISR timestamp diverges after the first micros() wrap
+                // (~71 min), collapsing the window to zero. ISR-to-drain
+                // skew is sub-millisecond, so millis() here is accurate.
+                lastDebounceTime[i] = millis();
+                lastEdgeTimestampUs[i] = event.timestampUs;
+                lastReadings[i] = reading;
+
+                if (debugPinChanges) {
+                    Telemetry::InputType inputType = getInputTypeFromPin(event.pin);
+                    telemetryManager.sendDigitalInput(event.pin, reading, false, 0, inputType);
+
+                    debugPrintf("[DI%d] ISR: edge @%luus -> %s (starting debounce)\n",
+                        event.pin, event.timestampUs, reading ? "ACTIVE" : "INACTIVE");
+                }
+            }
+            break;
+        }
+    }
+
+    // Report dropped edges (rare - buffer sized for worst-case switch bounce)
+    static unsigned long lastReportedOverflows = 0;
+    if (isrOverflowCount != lastReportedOverflows) {
+        LOG_WARN("INPUT: ISR event buffer overflow - %lu edges dropped total",
+                   (unsigned long)isrOverflowCount);
+        lastReportedOverflows = isrOverflowCount;
+    }
+}
+
+unsigned long InputManager::getIsrEventCount() const {
+    return isrEventCount;
+}
+
+unsigned long InputManager::getIsrOverflowCount() const {
+    return isrOverflowCount;
+}
+
 void InputManager::refreshPinStates() {
     for (size_t i = 0; i < WATCH_PIN_COUNT; i++) {
         uint8_t pin = WATCH_PINS[i];
@@ -66,24 +240,33 @@ void InputManager::refreshPinStates() {
 
 void InputManager::update() {
     unsigned long now = millis();
-    
+
+    // Drain ISR-captured limit switch edges first so their debounce windows
+    // are anchored to the true edge time instead of this poll
+    drainInterruptEvents();
+
+    // Latch all watched ports once so every pin sees the same instant
+    capturePortSnapshot();
+
     for (size_t i = 0; i < WATCH_PIN_COUNT; i++) {
         uint8_t pin = WATCH_PINS[i];
+        bool rawHigh = readPinRawHigh(i);
         bool reading;
-        
-        // Read pin according to its configuration
+
+        // Interpret raw level according to pin configuration
         if (configManager && configManager->isPinNC(i)) {
             // Normally closed: active when HIGH (open)
-            reading = digitalRead(pin) == HIGH;
+            reading = rawHigh;
         } else {
             // Normally open: active when LOW (pressed, with pullup)
-            reading = digitalRead(pin) == LOW;
+            reading = !rawHigh;
         }
         
         // Check for raw reading change
         if (reading != lastReadings[i]) {
             // Raw reading changed, reset debounce timer
             lastDebounceTime[i] = now;
+            lastEdgeTimestampUs[i] = micros();
             lastReadings[i] = reading;
             
             // Debug raw changes for limit switches (if enabled)
@@ -92,9 +275,9 @@ void InputManager::update() {
                 Telemetry::InputType inputType = getInputTypeFromPin(pin);
                 telemetryManager.sendDigitalInput(pin, reading, false, 0, inputType);
                 
-                debugPrintf("[DI%d] RAW: digitalRead()=%s -> %s (starting debounce)\n", 
-                    pin, 
-                    digitalRead(pin) == HIGH ? "HIGH" : "LOW",
+                debugPrintf("[DI%d] RAW: level=%s -> %s (starting debounce)\n",
+                    pin,
+                    rawHigh ? "HIGH" : "LOW",
                     reading ? "ACTIVE" : "INACTIVE"
                 );
             }
@@ -140,9 +323,13 @@ void InputManager::update() {
                 
                 // Network publishing removed - non-networking version
                 
-                // Notify callback if set
+                // Flight recorder: debounced edge with the pin's new state
+                flightRecorder.record(FLIGHT_INPUT_EDGE, pin, pinStates[i] ? 1 : 0);
+
+                // Notify callback if set (with the raw edge timestamp so
+                // relay cutoff latency can be measured from the real event)
                 if (inputChangeCallback) {
-                    inputChangeCallback(pin, pinStates[i], pinStates);
+                    inputChangeCallback(pin, pinStates[i], pinStates, lastEdgeTimestampUs[i]);
                 }
             }
         }
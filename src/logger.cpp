@@ -8,6 +8,11 @@ LogLevel Logger::currentLogLevel = LOG_INFO;  // Default to INFO level
 char Logger::logBuffer[512];
 bool Logger::telemetryEnabled = true;  // Default to enabled
 Stream* Logger::telemetryStream = &Serial;  // Default to Serial, can be changed
+Logger::DeferredRecord Logger::deferredRing[Logger::DEFERRED_RING_SIZE];
+uint8_t Logger::deferredHead = 0;
+uint8_t Logger::deferredTail = 0;
+uint32_t Logger::deferredDropCount = 0;
+bool Logger::deferredEnabled = true;  // Hot-path logs drain from loop()
 
 void Logger::begin() {
     // NetworkManager removed - non-networking version
@@ -53,67 +58,226 @@ const char* Logger::getLevelString(LogLevel level) {
     }
 }
 
-void Logger::log(LogLevel level, const char* fmt, ...) {
-    if (!shouldLog(level)) {
-        return;  // Don't log if below threshold
-    }
-    
-    // Format the message
-    va_list args;
-    va_start(args, fmt);
-    vsnprintf(logBuffer, sizeof(logBuffer), fmt, args);
-    va_end(args);
-    
+void Logger::printLine(LogLevel level, uint32_t timestampMs, const char* text) {
     // Network logging removed - non-networking version
     // All logging goes to telemetry stream - machine readable format
     if (telemetryStream) {
-        unsigned long ts = millis();
-        telemetryStream->print(ts);
+        telemetryStream->print(timestampMs);
         telemetryStream->print("|");
         telemetryStream->print(getLevelString(level));
         telemetryStream->print("|");
-        telemetryStream->println(logBuffer);
+        telemetryStream->println(text);
     }
 }
 
+void Logger::logv(LogLevel level, const char* fmt, va_list args) {
+    if (!shouldLog(level)) {
+        return;  // Don't log if below threshold
+    }
+
+    // Hot path: capture the format pointer and raw argument words into the
+    // deferred ring and return; formatting happens in processDeferred().
+    // ERROR and above bypass the ring so they reach the wire immediately.
+    if (deferredEnabled && level > LOG_ERROR) {
+        va_list argsCopy;
+        va_copy(argsCopy, args);
+        bool queued = enqueueDeferred(level, fmt, argsCopy);
+        va_end(argsCopy);
+        if (queued) {
+            return;
+        }
+        // Unsupported format - fall through to the synchronous path. A
+        // full ring is NOT a fall-through: enqueueDeferred() returns true
+        // after dropping the message (counted in deferredDropCount),
+        // because formatting synchronously under backlog would reintroduce
+        // exactly the hot-path stall the ring exists to avoid.
+    }
+
+    vsnprintf(logBuffer, sizeof(logBuffer), fmt, args);
+    printLine(level, millis(), logBuffer);
+}
+
+void Logger::log(LogLevel level, const char* fmt, ...) {
+    va_list args;
+    va_start(args, fmt);
+    logv(level, fmt, args);
+    va_end(args);
+}
+
 void Logger::logCritical(const char* fmt, ...) {
     va_list args;
     va_start(args, fmt);
-    vsnprintf(logBuffer, sizeof(logBuffer), fmt, args);
+    logv(LOG_CRITICAL, fmt, args);
     va_end(args);
-    log(LOG_CRITICAL, "%s", logBuffer);
 }
 
 void Logger::logError(const char* fmt, ...) {
     va_list args;
     va_start(args, fmt);
-    vsnprintf(logBuffer, sizeof(logBuffer), fmt, args);
+    logv(LOG_ERROR, fmt, args);
     va_end(args);
-    log(LOG_ERROR, "%s", logBuffer);
 }
 
 void Logger::logWarn(const char* fmt, ...) {
     va_list args;
     va_start(args, fmt);
-    vsnprintf(logBuffer, sizeof(logBuffer), fmt, args);
+    logv(LOG_WARNING, fmt, args);
     va_end(args);
-    log(LOG_WARNING, "%s", logBuffer);
 }
 
 void Logger::logInfo(const char* fmt, ...) {
     va_list args;
     va_start(args, fmt);
-    vsnprintf(logBuffer, sizeof(logBuffer), fmt, args);
+    logv(LOG_INFO, fmt, args);
     va_end(args);
-    log(LOG_INFO, "%s", logBuffer);
 }
 
 void Logger::logDebug(const char* fmt, ...) {
     va_list args;
     va_start(args, fmt);
-    vsnprintf(logBuffer, sizeof(logBuffer), fmt, args);
+    logv(LOG_DEBUG, fmt, args);
     va_end(args);
-    log(LOG_DEBUG, "%s", logBuffer);
+}
+
+// ============================================================================
+// Deferred Logging
+// ============================================================================
+
+void Logger::setDeferredLogging(bool enabled) {
+    deferredEnabled = enabled;
+}
+
+bool Logger::isDeferredLogging() {
+    return deferredEnabled;
+}
+
+uint32_t Logger::getDeferredDropCount() {
+    return deferredDropCount;
+}
+
+// Walk the format string and capture each argument as a 32-bit word.
+// %s arguments are copied into the record's string pool because the source
+// (often a shared buffer) may be overwritten before the drain step runs.
+// Returns false for formats we can't capture - caller logs synchronously.
+bool Logger::enqueueDeferred(LogLevel level, const char* fmt, va_list args) {
+    uint8_t nextHead = (deferredHead + 1) % DEFERRED_RING_SIZE;
+    if (nextHead == deferredTail) {
+        deferredDropCount++;
+        return true;  // Ring full - drop rather than stall the hot path
+    }
+
+    DeferredRecord& record = deferredRing[deferredHead];
+    record.fmt = fmt;
+    record.timestampMs = millis();
+    record.level = (uint8_t)level;
+    record.argCount = 0;
+    size_t poolUsed = 0;
+
+    for (const char* p = fmt; *p; p++) {
+        if (*p != '%') continue;
+        p++;
+        if (*p == '%') continue;  // Literal percent
+
+        // Skip flags, width and precision
+        while (*p && (strchr("-+ #0.123456789", *p) != nullptr)) p++;
+        bool isLong = false;
+        while (*p == 'l') { isLong = true; p++; }
+
+        if (record.argCount >= DEFERRED_MAX_ARGS) {
+            return false;  // Too many arguments to capture
+        }
+
+        switch (*p) {
+            case 'd': case 'i': case 'u': case 'x': case 'X': case 'o': case 'c':
+                record.args[record.argCount++] = isLong
+                    ? (uint32_t)va_arg(args, unsigned long)
+                    : (uint32_t)va_arg(args, unsigned int);
+                break;
+            case 'f': case 'F': case 'g': case 'G': case 'e': case 'E': {
+                float value = (float)va_arg(args, double);
+                memcpy(&record.args[record.argCount++], &value, sizeof(uint32_t));
+                break;
+            }
+            case 's': {
+                const char* str = va_arg(args, const char*);
+                if (!str) str = "(null)";
+                size_t len = strlen(str);
+                if (poolUsed + len + 1 > DEFERRED_STR_POOL_SIZE) {
+                    return false;  // String too large to defer - log synchronously
+                }
+                memcpy(record.strPool + poolUsed, str, len + 1);
+                record.args[record.argCount++] = (uint32_t)poolUsed;
+                poolUsed += len + 1;
+                break;
+            }
+            default:
+                return false;  // Unsupported conversion
+        }
+    }
+
+    deferredHead = nextHead;
+    return true;
+}
+
+// Re-expand a captured record: copy literal text, re-apply each conversion
+// spec with the stored argument word
+void Logger::formatDeferred(const DeferredRecord& record, char* out, size_t outSize) {
+    size_t outPos = 0;
+    uint8_t argIndex = 0;
+    char spec[12];
+
+    for (const char* p = record.fmt; *p && outPos < outSize - 1; p++) {
+        if (*p != '%') {
+            out[outPos++] = *p;
+            continue;
+        }
+
+        const char* specStart = p;
+        p++;
+        if (*p == '%') {
+            out[outPos++] = '%';
+            continue;
+        }
+        while (*p && (strchr("-+ #0.123456789", *p) != nullptr)) p++;
+        while (*p == 'l') p++;
+        if (!*p) break;  // Truncated conversion spec
+
+        size_t specLen = (size_t)(p - specStart) + 1;
+        if (specLen >= sizeof(spec) || argIndex >= record.argCount) break;
+        memcpy(spec, specStart, specLen);
+        spec[specLen] = '\0';
+
+        uint32_t word = record.args[argIndex++];
+        switch (*p) {
+            case 'd': case 'i': case 'u': case 'x': case 'X': case 'o': case 'c':
+                outPos += snprintf(out + outPos, outSize - outPos, spec, (unsigned long)word);
+                break;
+            case 'f': case 'F': case 'g': case 'G': case 'e': case 'E': {
+                float value;
+                memcpy(&value, &word, sizeof(float));
+                outPos += snprintf(out + outPos, outSize - outPos, spec, (double)value);
+                break;
+            }
+            case 's':
+                outPos += snprintf(out + outPos, outSize - outPos, spec, record.strPool + word);
+                break;
+            default:
+                break;
+        }
+        if (outPos >= outSize) outPos = outSize - 1;
+    }
+    out[outPos] = '\0';
+}
+
+void Logger::processDeferred() {
+    // Drain a couple of records per pass so a log burst can't monopolize
+    // the loop; timestamps reflect the original call time
+    for (uint8_t i = 0; i < 2 && deferredTail != deferredHead; i++) {
+        DeferredRecord& record = deferredRing[deferredTail];
+        formatDeferred(record, logBuffer, sizeof(logBuffer));
+        printLine((LogLevel)record.level, record.timestampMs, logBuffer);
+        deferredTail = (deferredTail + 1) % DEFERRED_RING_SIZE;
+    }
 }
 
 void Logger::setTelemetryEnabled(bool enabled) {
@@ -30,16 +30,24 @@
 #include "system_error_manager.h"
 #include "command_processor.h"
 #include "subsystem_timing_monitor.h"
+#include "hardware_watchdog.h"
+#include "memory_monitor.h"
+#include "flight_recorder.h"
+#include "response_streamer.h"
+#include "working_nau7802.h"
+#include "status_cache.h"
+#include "scratch_arena.h"
+#include "task_scheduler.h"
 #include "arduino_secrets.h"
 
 // ============================================================================
-// Global Shared Buffers (Memory Optimization)
+// Global Buffers
 // ============================================================================
 
-char g_message_buffer[SHARED_BUFFER_SIZE];
-char g_topic_buffer[TOPIC_BUFFER_SIZE];
+// Serial line accumulator - persistent across loop passes while a command
+// is being typed, so it stays a dedicated global. Transient formatting
+// goes through the scratch arena instead (see scratch_arena.h).
 char g_command_buffer[COMMAND_BUFFER_SIZE];
-char g_response_buffer[SHARED_BUFFER_SIZE];
 
 // ============================================================================
 // System Components
@@ -55,9 +63,23 @@ SystemErrorManager systemErrorManager;
 CommandProcessor commandProcessor;
 SubsystemTimingMonitor timingMonitor;
 TelemetryManager telemetryManager;
-
-// Telemetry output port (A4=TX, A5=RX) - A5 not used but required by constructor
+TaskScheduler taskScheduler;
+MemoryMonitor memoryMonitor;
+FlightRecorder flightRecorder;
+ResponseStreamer responseStreamer;
+NAU7802Sensor scaleSensor;
+StatusCache statusCache;
+ScratchArena scratchArena;
+
+// Telemetry output port (A4=TX, A5=RX)
+// Preferred backend is a hardware SCI channel (A4/A5 map to SCI0 on the R4),
+// whose TX is interrupt-driven in the core; SoftwareSerial bit-bangs every
+// byte with interrupts masked and is kept only as a fallback.
+#ifdef ARDUINO_ARCH_RENESAS_UNO
+UART telemetryUart(A4, A5);  // TX, RX pins (SCI0)
+#else
 SoftwareSerial telemetrySerial(A5, A4);  // RX, TX pins
+#endif
 
 // Global pointers for cross-module access
 RelayController* g_relayController = &relayController;
@@ -98,8 +120,8 @@ static uint8_t serialLinePos = 0;
 // ============================================================================
 
 void resetWatchdog() {
-    // Simple watchdog implementation (you may need to adapt for your specific board)
-    lastWatchdogReset = millis();
+    HardwareWatchdog::kick();
+    lastWatchdogReset = millis();  // Soft timestamp kept for checkSystemHealth() diagnostics
 }
 
 void checkSystemHealth() {
@@ -118,6 +140,9 @@ void checkSystemHealth() {
         // Log detailed timing report to identify bottleneck
         LOG_CRITICAL("=== TIMEOUT TIMING REPORT ===");
         timingMonitor.logTimingReport();
+
+        // Stream the event history leading into the stall
+        flightRecorder.dump("loop_timeout");
         
         // Emergency timeout detected - no network bypass needed in non-networking version
         
@@ -136,13 +161,12 @@ void checkSystemHealth() {
 // Legacy debugPrintf function - now uses new Logger system
 // This maintains compatibility with existing code
 void debugPrintf(const char* fmt, ...) {
+    // Pass the va_list straight through so the Logger captures arguments
+    // once (deferred) instead of formatting here and again inside log()
     va_list args;
     va_start(args, fmt);
-    vsnprintf(g_message_buffer, SHARED_BUFFER_SIZE, fmt, args);
+    Logger::logv(LOG_DEBUG, fmt, args);
     va_end(args);
-    
-    // Route to new logging system as DEBUG level
-    Logger::log(LOG_DEBUG, "%s", g_message_buffer);
 }
 
 // Helper function for readable sequence state names
@@ -166,8 +190,8 @@ const char* getSequenceStateName(SequenceState state) {
 // Callbacks
 // ============================================================================
 
-void onInputChange(uint8_t pin, bool state, const bool* allStates) {
-    debugPrintf("Input change: pin %d -> %s\n", pin, state ? "ACTIVE" : "INACTIVE");
+void onInputChange(uint8_t pin, bool state, const bool* allStates, unsigned long timestampUs) {
+    debugPrintf("Input change: pin %d -> %s (edge @%luus)\n", pin, state ? "ACTIVE" : "INACTIVE", timestampUs);
     
     // Update limit switch states for safety system
     if (pin == LIMIT_EXTEND_PIN) {
@@ -177,17 +201,19 @@ void onInputChange(uint8_t pin, bool state, const bool* allStates) {
         // SAFETY: Turn off extend relay when limit switch activates
         if (state) {  // Limit switch activated (cylinder fully extended)
             relayController.setRelay(RELAY_EXTEND, false);
-            debugPrintf("SAFETY: Extend relay R%d turned OFF - cylinder at full extension\n", RELAY_EXTEND);
+            debugPrintf("SAFETY: Extend relay R%d turned OFF - cylinder at full extension (cutoff %luus after edge)\n",
+                       RELAY_EXTEND, micros() - timestampUs);
         }
         
     } else if (pin == LIMIT_RETRACT_PIN) {
         g_limitRetractActive = state;
         debugPrintf("Limit RETRACT: %s\n", state ? "ACTIVE" : "INACTIVE");
         
-        // SAFETY: Turn off retract relay when limit switch activates  
+        // SAFETY: Turn off retract relay when limit switch activates
         if (state) {  // Limit switch activated (cylinder fully retracted)
             relayController.setRelay(RELAY_RETRACT, false);
-            debugPrintf("SAFETY: Retract relay R%d turned OFF - cylinder at full retraction\n", RELAY_RETRACT);
+            debugPrintf("SAFETY: Retract relay R%d turned OFF - cylinder at full retraction (cutoff %luus after edge)\n",
+                       RELAY_RETRACT, micros() - timestampUs);
         }
     }
     
@@ -273,54 +299,86 @@ void onInputChange(uint8_t pin, bool state, const bool* allStates) {
 // ============================================================================
 
 bool initializeSystem() {
+    // ---- Fast safe-state path ----
+    // Runs before any serial wait: after a power blip the machine may
+    // still be moving, so outputs are forced off and the safety chain is
+    // armed first. Nothing here touches Serial (writes to an unopened
+    // port are dropped by the core). The floor on this path is the relay
+    // board settle delays, not software.
+
+    // Relay controller first - forces every relay off
+    relayController.begin();
+
+    // Configuration next (EEPROM only) - input NC/NO semantics and the
+    // E-stop fast path both depend on the stored pin modes
+    configManager.begin();
+
+    // Inputs and safety system
+    inputManager.begin(&configManager);
+    inputManager.setChangeCallback(onInputChange);
+    safetySystem.setRelayController(&relayController);
+    safetySystem.setSequenceController(&sequenceController);
+    safetySystem.begin();  // Initialize engine relay to running state
+
+    // Time from reset to safety armed - reported in SystemStatus
+    uint32_t timeToSafeUs = micros();
+
+    // ---- Console and telemetry bring-up ----
+    // The (up to) 3 s USB CDC wait now happens with the machine already
+    // in a safe state
     Serial.begin(115200);
-    while (!Serial && millis() < 3000) { 
-        delay(10); 
+    while (!Serial && millis() < 3000) {
+        delay(10);
     }
-    
-    // Initialize telemetry serial port (A4=TX, A5=RX)
+
+    // Initialize telemetry port (A4=TX, A5=RX): hardware UART with
+    // interrupt-driven TX where available, SoftwareSerial fallback otherwise
+#ifdef ARDUINO_ARCH_RENESAS_UNO
+    telemetryManager.begin(&telemetryUart, 115200);
+#else
     telemetrySerial.begin(115200);
-    
-    // Initialize telemetry manager (use existing telemetrySerial to avoid conflicts)
     telemetryManager.begin(&telemetrySerial);
-    
+#endif
+    telemetryManager.setTimeToSafeState(timeToSafeUs);
+
     Serial.println();
     Serial.println("=== LogSplitter Controller v2.0 ===");
     Serial.println("Initializing system...");
-    
+    Serial.print("Safe state reached ");
+    Serial.print(timeToSafeUs / 1000);
+    Serial.println(" ms after reset");
+
     systemStartTime = millis();
     currentSystemState = SYS_INITIALIZING;
-    
-    // Initialize configuration first
-    configManager.begin();
+
+    // Paint the free RAM region before the init calls below push the
+    // stack deeper - the watermark then covers the whole run
+    memoryMonitor.begin();
+
     if (!configManager.isConfigValid()) {
         Serial.println("WARNING: Using default configuration");
     }
-    
+
     // Initialize pressure sensor
     pressureManager.begin();
     // Network manager removed - non-networking version
     // Note: Individual sensor configuration can be added via pressureManager.getSensor() if needed
-    
-    // Initialize relay controller
-    relayController.begin();
+
+    // Initialize log-weight scale (optional hardware - the acquisition
+    // state machine keeps retrying if the device is absent)
+    if (scaleSensor.begin() != NAU7802_OK) {
+        Serial.println("NAU7802 scale not detected - weight readings disabled");
+    }
+
+    // Apply stored configuration to the already-running controllers
     configManager.applyToRelayController(relayController);
-    
+
     // Initialize sequence controller
     configManager.applyToSequenceController(sequenceController);
-    
+
     // Apply saved log level configuration
     configManager.applyToLogger();
-    
-    // Initialize input manager
-    inputManager.begin(&configManager);
-    inputManager.setChangeCallback(onInputChange);
-    
-    // Initialize safety system
-    safetySystem.setRelayController(&relayController);
-    safetySystem.setSequenceController(&sequenceController);
-    safetySystem.begin();  // Initialize engine relay to running state
-    
+
     // Initialize system error manager
     systemErrorManager.begin();
     
@@ -333,13 +391,26 @@ bool initializeSystem() {
     commandProcessor.setInputManager(&inputManager);
     commandProcessor.setSystemErrorManager(&systemErrorManager);
     commandProcessor.setTimingMonitor(&timingMonitor);
-    
+    commandProcessor.setMemoryMonitor(&memoryMonitor);
+    commandProcessor.setResponseStreamer(&responseStreamer);
+    telemetryManager.setMemoryMonitor(&memoryMonitor);
+    telemetryManager.setSafetySystem(&safetySystem);
+
     // Connect error manager to other components
     configManager.setSystemErrorManager(&systemErrorManager);
     sequenceController.setErrorManager(&systemErrorManager);
     sequenceController.setInputManager(&inputManager);
     sequenceController.setSafetySystem(&safetySystem);
-    
+
+    // Prime the cached status snapshot now that every source exists
+    statusCache.setPressureManager(&pressureManager);
+    statusCache.setSequenceController(&sequenceController);
+    statusCache.setRelayController(&relayController);
+    statusCache.setSafetySystem(&safetySystem);
+    statusCache.setSystemErrorManager(&systemErrorManager);
+    statusCache.begin();
+
+
     Serial.println("Core systems initialized");
     
     // Initialize logger (Serial only - NO telemetry to maximize protobuf throughput)
@@ -352,7 +423,32 @@ bool initializeSystem() {
     // Initialize timing monitor
     timingMonitor.begin();
     LOG_INFO("Subsystem timing monitor initialized");
-    
+
+    // Arm the hardware watchdog. A wedged loop (stuck in a blocking call)
+    // never reaches checkSystemHealth(); the hardware watchdog resets the
+    // MCU within WATCHDOG_TIMEOUT_MS regardless.
+    if (HardwareWatchdog::begin(WATCHDOG_TIMEOUT_MS)) {
+        LOG_INFO("Hardware watchdog armed (%lu ms window)", (unsigned long)WATCHDOG_TIMEOUT_MS);
+    } else {
+        LOG_WARN("Hardware watchdog unavailable - soft health check only");
+    }
+
+    // If this boot was a watchdog recovery, report which subsystem hung
+    if (HardwareWatchdog::resetByWatchdog()) {
+        uint8_t hungId = HardwareWatchdog::lastSubsystemBeforeReset();
+        const char* hungName = timingMonitor.getSubsystemNameById(hungId);
+        Serial.print("WATCHDOG RESET: recovered from hang in ");
+        Serial.println(hungName);
+        LOG_CRITICAL("Watchdog reset - last subsystem before hang: %s (id=%u)", hungName, hungId);
+        ScratchBuffer msg;
+        if (msg.valid()) {
+            snprintf(msg.get(), msg.size(), "Watchdog reset - hung in %s", hungName);
+            systemErrorManager.setError(ERROR_HARDWARE_FAULT, msg.get());
+        } else {
+            systemErrorManager.setError(ERROR_HARDWARE_FAULT, "Watchdog reset");
+        }
+    }
+
     currentSystemState = SYS_RUNNING;
     lastPublishTime = millis();
     
@@ -366,50 +462,138 @@ bool initializeSystem() {
 // Main System Loop
 // ============================================================================
 
-void updateSystem() {
-    TIME_SUBSYSTEM(&timingMonitor, SubsystemID::MAIN_LOOP_TOTAL);
-    resetWatchdog();
-    
-    // Update all subsystems with timing monitoring
-    // Network manager and telnet removed in non-networking version
-    
-    {
-        TIME_SUBSYSTEM(&timingMonitor, SubsystemID::PRESSURE_MANAGER);
-        pressureManager.update();
-    }
-    
-    {
-        TIME_SUBSYSTEM(&timingMonitor, SubsystemID::SEQUENCE_CONTROLLER);
-        sequenceController.update();
-    }
-    
-    {
-        TIME_SUBSYSTEM(&timingMonitor, SubsystemID::RELAY_CONTROLLER);
-        relayController.update();
-    }
-    
-    {
-        TIME_SUBSYSTEM(&timingMonitor, SubsystemID::INPUT_MANAGER);
-        inputManager.update();
-    }
-    
-    {
-        TIME_SUBSYSTEM(&timingMonitor, SubsystemID::SYSTEM_ERROR_MANAGER);
-        systemErrorManager.update();
-    }
-    
+// Task wrappers - each scheduled step keeps its subsystem timing scope.
+// Registered in registerScheduledTasks() with explicit per-task rates.
+
+static void taskInput() {
+    TIME_SUBSYSTEM(&timingMonitor, SubsystemID::INPUT_MANAGER);
+    inputManager.update();
+}
+
+static void taskSequence() {
+    TIME_SUBSYSTEM(&timingMonitor, SubsystemID::SEQUENCE_CONTROLLER);
+    sequenceController.update();
+}
+
+static void taskRelay() {
+    TIME_SUBSYSTEM(&timingMonitor, SubsystemID::RELAY_CONTROLLER);
+    relayController.update();
+}
+
+static void taskSafety() {
     // Update safety system with current pressure
     if (pressureManager.isReady()) {
         TIME_SUBSYSTEM(&timingMonitor, SubsystemID::SAFETY_SYSTEM);
         safetySystem.update(pressureManager.getPressure());
     }
-    
-    // Check timing monitor health
+}
+
+static void taskPressure() {
+    TIME_SUBSYSTEM(&timingMonitor, SubsystemID::PRESSURE_MANAGER);
+    pressureManager.update();
+}
+
+static void taskErrors() {
+    TIME_SUBSYSTEM(&timingMonitor, SubsystemID::SYSTEM_ERROR_MANAGER);
+    systemErrorManager.update();
+}
+
+static void taskTelemetryDrain() {
+    TIME_SUBSYSTEM(&timingMonitor, SubsystemID::TELEMETRY_MANAGER);
+    telemetryManager.update();  // Flush batches and drain telemetry TX ring
+}
+
+static void taskConfigSave() {
+    // Background EEPROM save step - commits pending config a chunk at a time
+    configManager.update();
+}
+
+static void taskLogDrain() {
+    // Drain deferred log records queued by hot-path call sites
+    Logger::processDeferred();
+}
+
+static void taskHealth() {
+    // Check timing monitor health and the main-loop watchdog
     timingMonitor.checkHealthStatus();
-    
     checkSystemHealth();
 }
 
+// E-stop fast path: direct pin read ahead of everything else in the loop,
+// with an immediate relay cutoff that bypasses the command queue. The normal
+// debounced path through InputManager/activateEStop() still runs afterwards
+// and performs the full safety bookkeeping; this path only kills the
+// extend/retract relays as fast as possible and measures how long it took.
+// No debounce on purpose - a false trigger errs in the safe direction.
+static void checkEStopFastPath() {
+    static bool fastPathLatched = false;
+
+    // Mirror InputManager's NC/NO interpretation: NC = active when HIGH,
+    // NO = active when LOW (pullup). Pressed = logical inactive (onInputChange
+    // treats !state as the E-stop press).
+    bool rawHigh = (digitalRead(E_STOP_PIN) == HIGH);
+    bool active = configManager.getPinMode(E_STOP_PIN) ? rawHigh : !rawHigh;
+    bool pressed = !active;
+
+    if (pressed && !fastPathLatched) {
+        unsigned long tDetect = micros();
+        relayController.emergencyCutoff();
+        unsigned long tDone = micros();
+        fastPathLatched = true;
+
+        safetySystem.noteEStopReaction(tDetect, tDone);
+        LOG_CRITICAL("E-STOP fast path: relays cut in %luus",
+                     (unsigned long)(tDone - tDetect));
+    } else if (!pressed && fastPathLatched) {
+        // Re-arm once the button is released; the debounced path governs
+        // the actual safe-state recovery sequence
+        fastPathLatched = false;
+    }
+}
+
+// Raw overpressure fast path: the per-sample comparator in the ADC ISR
+// latches a trip when M of the last N raw samples exceed the ceiling -
+// hundreds of milliseconds before the filtered value would cross
+// SAFETY_THRESHOLD_PSI. Service it here ahead of all scheduled work,
+// mirroring the E-stop fast path: cut the relays through the priority
+// path first, then hand off to SafetySystem for the latched handling.
+static void checkOverpressureFastPath() {
+    PressureSensorChannel& hydraulic = pressureManager.getSensor(SENSOR_HYDRAULIC);
+
+    if (hydraulic.overpressureTripPending()) {
+        relayController.emergencyCutoff();
+        uint32_t tDone = micros();
+        hydraulic.serviceOverpressureTrip();
+
+        uint32_t latencyUs = tDone - hydraulic.overpressureTripMicros();
+        if (latencyUs > 0xFFFF) latencyUs = 0xFFFF;
+        safetySystem.notifyOverpressureTrip(hydraulic.getPeakPressure(),
+                                            (uint16_t)latencyUs);
+        return;
+    }
+
+    // Re-arm only after the operator clears the latched safety state
+    if (hydraulic.overpressureTripLatched() && !safetySystem.isActive()) {
+        hydraulic.rearmOverpressure();
+    }
+}
+
+void updateSystem() {
+    // Loop-to-loop interval feeds the jitter histogram before anything else
+    // runs this pass (see "show loopstats" / "timing outlier")
+    timingMonitor.noteLoopIteration();
+
+    TIME_SUBSYSTEM(&timingMonitor, SubsystemID::MAIN_LOOP_TOTAL);
+    resetWatchdog();
+
+    // Fast paths run first, ahead of all scheduled work
+    checkEStopFastPath();
+    checkOverpressureFastPath();
+
+    // Run everything that is due this pass (table order = priority order)
+    taskScheduler.runOnce();
+}
+
 void publishTelemetry() {
     // Protobuf telemetry is always active for maximum throughput
     unsigned long now = millis();
@@ -500,18 +684,29 @@ void processSerialCommands() {
             serialLinePos = 0;
             
             if (strlen(g_command_buffer) > 0) {
-                // Process command
-                bool success = commandProcessor.processCommand(g_command_buffer, false, g_response_buffer, SHARED_BUFFER_SIZE);
-                
-                if (strlen(g_response_buffer) > 0) {
-                    Serial.print("Response: ");
-                    Serial.println(g_response_buffer);
-                }
-                
-                if (!success) {
-                    Serial.println("Command failed. Type 'help' for available commands.");
+                // Scratch slot scoped to this command - a log call from
+                // another context can't clobber a half-built response
+                ScratchBuffer response;
+                if (response.valid()) {
+                    bool success = commandProcessor.processCommand(g_command_buffer, false, response.get(), response.size());
+
+                    // Queue the reply instead of blocking on Serial.print - the
+                    // response streamer drains it in TX-buffer-sized chunks from
+                    // subsequent loop passes (large handlers stream directly)
+                    if (strlen(response.get()) > 0) {
+                        responseStreamer.write("Response: ");
+                        responseStreamer.write(response.get());
+                        responseStreamer.write("\r\n");
+                    }
+
+                    if (!success) {
+                        responseStreamer.write("Command failed. Type 'help' for available commands.\r\n");
+                    }
+                } else {
+                    // Counted in the arena's overflow diagnostic
+                    responseStreamer.write("Busy - no scratch buffer free, retry\r\n");
                 }
-                
+
                 if (g_echoEnabled) Serial.print("> "); // Prompt for next command
             }
         } else {
@@ -524,11 +719,67 @@ void processSerialCommands() {
 
 // Telnet command processing removed - non-networking version
 
+// ============================================================================
+// Task Registration
+// ============================================================================
+
+static void taskPublish() {
+    publishTelemetry();
+}
+
+static void taskSerial() {
+    processSerialCommands();
+}
+
+static void taskMemory() {
+    memoryMonitor.update();
+}
+
+static void taskResponseDrain() {
+    // Push queued command replies out in TX-buffer-sized chunks
+    responseStreamer.update();
+}
+
+static void taskScale() {
+    // One acquisition step: data-ready poll or conversion read, never both
+    scaleSensor.updateReading();
+}
+
+static void taskStatusCache() {
+    // Reformat at most one dirty status section per pass
+    statusCache.update();
+}
+
+// Build the scheduler table. Order is priority: the safety-relevant
+// subsystems (inputs, sequencing, relay queue, safety checks) run every
+// pass; sampled and housekeeping work runs at its own rate instead of
+// being called thousands of times a second only to bail on an internal
+// interval check.
+static void registerScheduledTasks() {
+    taskScheduler.addTask("input",     taskInput,          0);    // Every pass - limit/E-stop edges
+    taskScheduler.addTask("sequence",  taskSequence,       0);    // Every pass - state machine edges
+    taskScheduler.addTask("relay",     taskRelay,          0);    // Every pass - command queue/responses
+    taskScheduler.addTask("safety",    taskSafety,         0);    // Every pass - pressure cutoffs
+    taskScheduler.addTask("serial",    taskSerial,         0);    // Every pass - command input
+    taskScheduler.addTask("telemetry", taskTelemetryDrain, 0);    // Every pass - cheap when ring empty
+    taskScheduler.addTask("logdrain",  taskLogDrain,       0);    // Every pass - cheap when ring empty
+    taskScheduler.addTask("respdrain", taskResponseDrain,  0);    // Every pass - cheap when ring empty
+    taskScheduler.addTask("pressure",  taskPressure,       25);   // Sampling gated at SAMPLE_INTERVAL_MS internally
+    taskScheduler.addTask("scale",     taskScale,          10);   // One short I2C transaction per pass (80 SPS)
+    taskScheduler.addTask("errors",    taskErrors,         10);   // LED pattern resolution
+    taskScheduler.addTask("cfgsave",   taskConfigSave,     5);    // Chunked EEPROM commit
+    taskScheduler.addTask("publish",   taskPublish,        10);   // Event-driven telemetry bookkeeping
+    taskScheduler.addTask("statcache", taskStatusCache,    25);   // At most one section snprintf per pass
+    taskScheduler.addTask("health",    taskHealth,         1000); // Watchdog + timing health
+    taskScheduler.addTask("memory",    taskMemory,         5000); // Stack/heap watermark scan
+}
+
 // ============================================================================
 // Arduino Main Functions
 // ============================================================================
 
 void setup() {
+    registerScheduledTasks();
     if (!initializeSystem()) {
         Serial.println("CRITICAL ERROR: System initialization failed");
         currentSystemState = SYS_ERROR;
@@ -543,9 +794,9 @@ void loop() {
     // Handle system states
     switch (currentSystemState) {
         case SYS_RUNNING:
+            // All subsystem updates, telemetry publishing and serial command
+            // handling run from the scheduler at their registered rates
             updateSystem();
-            publishTelemetry();
-            processSerialCommands();
             break;
             
         case SYS_ERROR:
@@ -566,7 +817,6 @@ void loop() {
             currentSystemState = SYS_ERROR;
             break;
     }
-    
-    // Small delay to prevent overwhelming the system
-    delay(1);
+    // No unconditional delay here - the scheduler idle-sleeps only when
+    // nothing is due, so input handling runs back-to-back at full rate
 }
\ No newline at end of file
@@ -0,0 +1,83 @@
+#include "memory_monitor.h"
+#include "logger.h"
+
+// newlib heap break - everything between here and the stack pointer is
+// the free region we paint and watch
+#ifdef ARDUINO_ARCH_RENESAS_UNO
+extern "C" char* sbrk(int incr);
+static char* heapBreak() { return (char*)sbrk(0); }
+#else
+// Host/test builds: no meaningful break, use a static stand-in region
+static char hostRegion[1024];
+static char* heapBreak() { return hostRegion; }
+#endif
+
+void MemoryMonitor::begin() {
+    // Current stack pointer approximated by a local's address; leave a
+    // guard gap below it so painting can't touch this frame or an
+    // interrupt frame that lands while we paint
+    char stackMarker;
+    const uint32_t GUARD_BYTES = 256;
+
+    char* base = heapBreak();
+    char* top = &stackMarker - GUARD_BYTES;
+    if (top <= base) {
+        LOG_WARN("MemoryMonitor: no free region to paint");
+        return;
+    }
+
+    // Word-align the span
+    paintBase = (uint32_t*)(((uintptr_t)base + 3) & ~(uintptr_t)3);
+    paintTop = (uint32_t*)((uintptr_t)top & ~(uintptr_t)3);
+
+    for (uint32_t* p = paintBase; p < paintTop; p++) {
+        *p = PAINT_WORD;
+    }
+    paintedBytes = (uint32_t)((char*)paintTop - (char*)paintBase);
+    stackHeadroom = paintedBytes;
+    freeLowWater = getFreeBytes();
+
+    LOG_INFO("MemoryMonitor: painted %lu bytes of free region",
+        (unsigned long)paintedBytes);
+}
+
+void MemoryMonitor::update() {
+    if (!paintBase) return;
+
+    // The heap break can move up into the painted span; don't count heap
+    // growth as stack depth
+    uint32_t* scanStart = (uint32_t*)(((uintptr_t)heapBreak() + 3) & ~(uintptr_t)3);
+    if (scanStart < paintBase) scanStart = paintBase;
+
+    // First clobbered word above the break marks the deepest stack
+    // excursion; everything below it is margin that was never used
+    uint32_t* p = scanStart;
+    while (p < paintTop && *p == PAINT_WORD) {
+        p++;
+    }
+    uint32_t headroom = (uint32_t)((char*)p - (char*)scanStart);
+    if (headroom < stackHeadroom) {
+        stackHeadroom = headroom;
+    }
+
+    uint32_t freeNow = getFreeBytes();
+    if (freeNow < freeLowWater) {
+        freeLowWater = freeNow;
+    }
+}
+
+uint32_t MemoryMonitor::getFreeBytes() const {
+    char stackMarker;
+    char* base = heapBreak();
+    if (&stackMarker <= base) return 0;
+    return (uint32_t)(&stackMarker - base);
+}
+
+void MemoryMonitor::getStatusString(char* buffer, size_t bufferSize) {
+    snprintf(buffer, bufferSize,
+        "free=%lu lowWater=%lu stackHeadroom=%lu painted=%lu",
+        (unsigned long)getFreeBytes(),
+        (unsigned long)(freeLowWater == 0xFFFFFFFF ? 0 : freeLowWater),
+        (unsigned long)stackHeadroom,
+        (unsigned long)paintedBytes);
+}
@@ -1,10 +1,35 @@
 #include "pressure_manager.h"
 #include "telemetry_manager.h"
+#include "logger.h"
 // NetworkManager include removed - non-networking version
 
+#ifdef ARDUINO_ARCH_RENESAS_UNO
+#include "FspTimer.h"
+#endif
+
 extern void debugPrintf(const char* fmt, ...);
 extern TelemetryManager telemetryManager;
 
+// ============================================================================
+// High-Rate ADC Sampling ISR
+// ============================================================================
+
+#ifdef ARDUINO_ARCH_RENESAS_UNO
+// 1 kHz AGT timer drives acquisition for both channels; each conversion
+// lands in the owning channel's ring buffer. analogRead() is safe at IRQ
+// level on this core (polled conversion, ~20 us per channel).
+static FspTimer adcSampleTimer;
+static PressureManager* s_adcIsrManager = nullptr;
+
+static void adcSampleIsr(timer_callback_args_t* /*args*/) {
+    if (!s_adcIsrManager) return;
+    for (int i = 0; i < SENSOR_COUNT; i++) {
+        PressureSensorChannel& sensor = s_adcIsrManager->getSensor((PressureSensorType)i);
+        sensor.isrRecordSample((uint16_t)analogRead(sensor.getPin()));
+    }
+}
+#endif
+
 // ============================================================================
 // PressureSensorChannel Implementation
 // ============================================================================
@@ -22,64 +47,176 @@ void PressureSensorChannel::begin(uint8_t pin, float maxPsi) {
     
     // Initialize filter state
     emaValue = 0.0f;
-    
-    debugPrintf("PressureSensorChannel initialized: pin A%d, max %.1f PSI\n", 
+
+    // Fold the conversion model into the Q16 scale+bias
+    recomputeConversion();
+
+    debugPrintf("PressureSensorChannel initialized: pin A%d, max %.1f PSI\n",
         pin - A0, maxPsi);
 }
 
 void PressureSensorChannel::update() {
+    // High-rate mode: the ISR has been filling the ring since the last
+    // pass - reduce it instead of taking a single polled sample
+    if (highRateEnabled) {
+        reduceRing();
+        return;
+    }
+
     unsigned long now = millis();
-    
+
     if (now - lastSampleTime >= SAMPLE_INTERVAL_MS) {
         int rawValue = analogRead(analogPin);
+        feedOverpressureComparator((uint16_t)rawValue);
         int filteredValue = applyFilter(rawValue);
         updateSample(filteredValue);
-        
-        // Calculate current pressure
-        float avgCounts = computeAverageCount();
-            float voltage = (avgCounts / (float)(1 << ADC_RESOLUTION_BITS)) * adcVref;
-            lastVoltage = voltage; // store raw computed voltage before clamping / mapping for diagnostics
-
-            // Extended scaling only for main hydraulic sensor (A1)
-            if (analogPin == HYDRAULIC_PRESSURE_PIN) {
-                // Extended scaling path (A1 only):
-                // Voltage 0..vfs (nominally 5.0V) spans -NEG_FRAC .. (1 + POS_FRAC) of nominal pressure.
-                // Example with fractions 0.25 & 0.25 and nominal=5000:
-                //   0V  -> -1250 PSI (clamped to 0 for reporting)
-                //   5V  ->  6250 PSI (clamped to 5000 for reporting)
-                // This creates over-range headroom and sub-zero dead-band while keeping published values bounded.
-                const float nominal = HYDRAULIC_MAX_PRESSURE_PSI;
-                const float span = (1.0f + MAIN_PRESSURE_EXT_NEG_FRAC + MAIN_PRESSURE_EXT_POS_FRAC) * nominal; // e.g. 1.5 * nominal
-                float vfs = MAIN_PRESSURE_EXT_FSV;
-                if (vfs <= 0.1f) vfs = adcVref; // Fallback: avoid divide-by-near-zero if constant misconfigured
-
-                // Bound measured voltage to modeled full-scale
-                if (voltage < 0.0f) voltage = 0.0f;
-                if (voltage > vfs) voltage = vfs;
-
-                // Compute raw (unclamped) extended pressure then shift negative offset
-                float rawPsi = (voltage / vfs) * span - (MAIN_PRESSURE_EXT_NEG_FRAC * nominal);
-
-                // NOTE: If raw (unclamped) value is ever needed for diagnostics, store before clamp.
-                if (rawPsi < 0.0f) rawPsi = 0.0f;
-                if (rawPsi > nominal) rawPsi = nominal;
-                currentPressure = rawPsi; // Only clamped value used by safety & telemetry
-            } else {
-                currentPressure = voltageToPressure(voltage);
-            }
-        
+
+        // Calculate current pressure - integer multiply-shift-add, float
+        // only at the reporting boundary
+        int32_t avgQ16 = computeAverageCountQ16();
+        currentPressure = (float)countsToPsiQ16(avgQ16) * (1.0f / 65536.0f);
+        lastVoltage = (float)avgQ16 * (1.0f / 65536.0f) * voltsPerCount;
+        peakPressure = currentPressure;  // No intra-window peak in polled mode
+
         lastSampleTime = now;
     }
 }
 
+void PressureSensorChannel::isrRecordSample(uint16_t rawCounts) {
+    // ISR context: single store + head advance, no shared sums
+    adcRing[adcRingHead] = rawCounts;
+    adcRingHead = (adcRingHead + 1) & (ADC_RING_SIZE - 1);
+    isrSampleCount++;
+
+    feedOverpressureComparator(rawCounts);
+}
+
+void PressureSensorChannel::feedOverpressureComparator(uint16_t rawCounts) {
+    // Shift-register compare against the precomputed counts ceiling. When
+    // disabled the ceiling sits above any 10-bit sample, so this is a
+    // couple of cycles of always-false work - no branch needed.
+    opSampleWindow = (uint8_t)(((opSampleWindow << 1) | (rawCounts >= opCeilingCounts ? 1 : 0))
+                               & ((1u << OVERPRESSURE_WINDOW_N) - 1));
+
+    if (!opTripLatched &&
+        __builtin_popcount(opSampleWindow) >= OVERPRESSURE_CONFIRM_M) {
+        // M-of-N confirmed: latch the trip and timestamp it. The fast path
+        // in the main loop does the relay cutoff and reports detect-to-cut
+        // latency from this timestamp.
+        opTripLatched = true;
+        opTripMicros = micros();
+        opTripPending = true;
+    }
+}
+
+void PressureSensorChannel::reduceRing() {
+    size_t head = adcRingHead;  // Snapshot - ISR only advances head
+    size_t tail = adcRingTail;
+    size_t available = (head - tail) & (ADC_RING_SIZE - 1);
+    if (available == 0) return;
+
+    // Reduce every new sample to mean/min/max. At 1 kHz with a 25 ms
+    // update period this is ~25 samples, far from the ring's capacity.
+    uint32_t sum = 0;
+    uint16_t minCounts = 0xFFFF;
+    uint16_t maxCounts = 0;
+    for (size_t i = 0; i < available; i++) {
+        uint16_t value = adcRing[tail];
+        tail = (tail + 1) & (ADC_RING_SIZE - 1);
+        sum += value;
+        if (value < minCounts) minCounts = value;
+        if (value > maxCounts) maxCounts = value;
+    }
+    adcRingTail = tail;
+    windowMinCounts = minCounts;
+    windowMaxCounts = maxCounts;
+
+    // Feed the window mean through the existing filter/averaging pipeline
+    // so the reported pressure keeps its smoothing characteristics
+    int meanCounts = (int)(sum / available);
+    int filteredValue = applyFilter(meanCounts);
+    updateSample(filteredValue);
+
+    int32_t avgQ16 = computeAverageCountQ16();
+    currentPressure = (float)countsToPsiQ16(avgQ16) * (1.0f / 65536.0f);
+    lastVoltage = (float)avgQ16 * (1.0f / 65536.0f) * voltsPerCount;
+
+    // True peak over the window - a spike between updates can't hide in
+    // the mean anymore
+    peakPressure = (float)countsToPsiQ16((int32_t)maxCounts << 16) * (1.0f / 65536.0f);
+
+    lastSampleTime = millis();
+}
+
+void PressureSensorChannel::recomputeConversion() {
+    // Collapse the per-pin conversion model (counts -> volts -> PSI with
+    // calibration) into psi = clamp(scale * counts + bias, lo, hi). The
+    // float math runs once per configuration change; the per-sample path
+    // in countsToPsiQ16() never divides again.
+    voltsPerCount = adcVref / (float)(1 << ADC_RESOLUTION_BITS);
+
+    float psiPerVolt;
+    float psiAtZeroVolts;
+    float clampLo, clampHi;
+
+    if (analogPin == HYDRAULIC_PRESSURE_PIN) {
+        // Extended scaling path (A1 only):
+        // Voltage 0..vfs (nominally 5.0V) spans -NEG_FRAC .. (1 + POS_FRAC) of nominal pressure.
+        // Example with fractions 0.25 & 0.25 and nominal=5000:
+        //   0V  -> -1250 PSI (clamped to 0 for reporting)
+        //   5V  ->  6250 PSI (clamped to 5000 for reporting)
+        // This creates over-range headroom and sub-zero dead-band while keeping published values bounded.
+        const float nominal = HYDRAULIC_MAX_PRESSURE_PSI;
+        const float span = (1.0f + MAIN_PRESSURE_EXT_NEG_FRAC + MAIN_PRESSURE_EXT_POS_FRAC) * nominal; // e.g. 1.5 * nominal
+        float vfs = MAIN_PRESSURE_EXT_FSV;
+        if (vfs <= 0.1f) vfs = adcVref; // Fallback: avoid divide-by-near-zero if constant misconfigured
+
+        psiPerVolt = span / vfs;
+        psiAtZeroVolts = -(MAIN_PRESSURE_EXT_NEG_FRAC * nominal);
+        clampLo = 0.0f;       // Sub-zero dead-band
+        clampHi = nominal;    // Over-range headroom stays internal
+    } else {
+        // A5: Filter pressure sensor - 0-5V voltage output (configurable)
+        // Generic linear 0..SENSOR_MAX_VOLTAGE => 0..maxPressurePsi with
+        // calibration (gain + offset). The old per-sample voltage clamp
+        // maps to clamping the monotonic output at the image of the
+        // voltage bounds.
+        psiPerVolt = (maxPressurePsi / SENSOR_MAX_VOLTAGE) * sensorGain;
+        psiAtZeroVolts = sensorOffset;
+        float atMin = SENSOR_MIN_VOLTAGE * psiPerVolt + sensorOffset;
+        float atMax = SENSOR_MAX_VOLTAGE * psiPerVolt + sensorOffset;
+        clampLo = (atMin < atMax) ? atMin : atMax;
+        clampHi = (atMin < atMax) ? atMax : atMin;
+    }
+
+    psiScaleQ16 = (int32_t)lroundf(psiPerVolt * voltsPerCount * 65536.0f);
+    psiBiasQ16 = (int32_t)lroundf(psiAtZeroVolts * 65536.0f);
+    psiClampLoQ16 = (int32_t)lroundf(clampLo * 65536.0f);
+    psiClampHiQ16 = (int32_t)lroundf(clampHi * 65536.0f);
+
+    // Fold the overpressure ceiling into a raw counts compare for the
+    // per-sample comparator (inverse of the affine conversion, rounded up
+    // so the trip fires at or above the PSI ceiling)
+    float psiPerCount = psiPerVolt * voltsPerCount;
+    if (overpressureCeilingPsi > 0.0f && psiPerCount > 0.0f) {
+        float counts = (overpressureCeilingPsi - psiAtZeroVolts) / psiPerCount;
+        if (counts < 0.0f) counts = 0.0f;
+        opCeilingCounts = (counts > 65534.0f) ? 0xFFFF : (uint16_t)ceilf(counts);
+    } else {
+        opCeilingCounts = 0xFFFF;  // Above any 10-bit sample - comparator off
+    }
+}
+
 int PressureSensorChannel::applyFilter(int rawValue) {
     switch (filterMode) {
         case FILTER_NONE:
             return rawValue;
             
         case FILTER_MEDIAN3: {
-            // Simple median-of-3 filter (needs previous values)
-            static int prev1 = rawValue, prev2 = rawValue;
+            // Simple median-of-3 filter (per-channel history - this was a
+            // function-local static, silently shared between A1 and A5)
+            int prev1 = med3Prev1;
+            int prev2 = med3Prev2;
             int median = rawValue;
             if ((rawValue >= prev1 && rawValue <= prev2) || (rawValue >= prev2 && rawValue <= prev1)) {
                 median = rawValue;
@@ -88,11 +225,15 @@ int PressureSensorChannel::applyFilter(int rawValue) {
             } else {
                 median = prev2;
             }
-            prev2 = prev1;
-            prev1 = rawValue;
+            med3Prev2 = prev1;
+            med3Prev1 = rawValue;
             return median;
         }
-            
+
+        case FILTER_MEDIAN_N:
+            // Incrementally sorted window - O(log n) insert, see median_filter.h
+            return (int)medianFilter.insert((uint16_t)rawValue);
+
         case FILTER_EMA:
             if (emaValue == 0.0f) emaValue = rawValue;
             emaValue = emaAlpha * rawValue + (1.0f - emaAlpha) * emaValue;
@@ -119,37 +260,11 @@ void PressureSensorChannel::updateSample(int filteredValue) {
     sampleIndex = (sampleIndex + 1) % SAMPLE_WINDOW_COUNT;
 }
 
-float PressureSensorChannel::computeAverageCount() {
-    if (samplesFilled == 0) return 0.0f;
-    return (float)samplesSum / (float)samplesFilled;
-}
-
-float PressureSensorChannel::voltageToPressure(float voltage) {
-    // Differentiate between sensor types based on analog pin
-    bool isSystemPressure = (analogPin == HYDRAULIC_PRESSURE_PIN);  // A1 = system pressure
-    
-    if (isSystemPressure) {
-        // A1: System pressure sensor - 4-20mA current loop
-        // 4mA × 250Ω = 1V = 0 PSI, 20mA × 250Ω = 5V = 5000 PSI
-        float psi = 0.0f;
-        if (voltage >= CURRENT_LOOP_MIN_VOLTAGE) {
-            float voltageRange = CURRENT_LOOP_MAX_VOLTAGE - CURRENT_LOOP_MIN_VOLTAGE; // 4V
-            float normalizedVoltage = voltage - CURRENT_LOOP_MIN_VOLTAGE; // Remove 1V offset
-            if (normalizedVoltage < 0.0f) normalizedVoltage = 0.0f;
-            if (normalizedVoltage > voltageRange) normalizedVoltage = voltageRange;
-            psi = (normalizedVoltage / voltageRange) * maxPressurePsi;
-        }
-        // Apply calibration (gain + offset)
-        return psi * sensorGain + sensorOffset;
-    } else {
-        // A5: Filter pressure sensor - 0-5V voltage output (configurable)
-        // Generic linear 0..SENSOR_MAX_VOLTAGE => 0..maxPressurePsi with calibration
-        if (voltage < SENSOR_MIN_VOLTAGE) voltage = SENSOR_MIN_VOLTAGE;
-        if (voltage > SENSOR_MAX_VOLTAGE) voltage = SENSOR_MAX_VOLTAGE;
-        float psi = (voltage / SENSOR_MAX_VOLTAGE) * maxPressurePsi;
-        // Apply calibration (gain + offset)
-        return psi * sensorGain + sensorOffset;
-    }
+int32_t PressureSensorChannel::computeAverageCountQ16() const {
+    if (samplesFilled == 0) return 0;
+    // Keep the fractional part of the window mean in Q16 so the conversion
+    // doesn't quantize at one-count resolution
+    return (int32_t)(((uint64_t)samplesSum << 16) / samplesFilled);
 }
 
 // ============================================================================
@@ -161,11 +276,60 @@ void PressureManager::begin() {
     sensors[SENSOR_HYDRAULIC].begin(HYDRAULIC_PRESSURE_PIN, HYDRAULIC_MAX_PRESSURE_PSI);
     sensors[SENSOR_HYDRAULIC_OIL].begin(HYDRAULIC_OIL_PRESSURE_PIN, HYDRAULIC_MAX_PRESSURE_PSI);
     
-    lastPublishTime = 0;
-    
+    for (int i = 0; i < SENSOR_COUNT; i++) {
+        lastSentPsi[i] = 0.0f;
+        lastSentMs[i] = 0;
+    }
+
     debugPrintf("PressureManager initialized with 2 sensors:\n");
     debugPrintf("  - Hydraulic System Pressure (A1): 0-%d PSI\n", HYDRAULIC_MAX_PRESSURE_PSI);
     debugPrintf("  - Hydraulic Filter Pressure (A5): 0-%d PSI\n", HYDRAULIC_MAX_PRESSURE_PSI);
+
+    // Start 1 kHz interrupt-driven acquisition; falls back to the 100 ms
+    // polled path if no hardware timer is available
+    if (beginHighRateSampling()) {
+        debugPrintf("PressureManager: high-rate sampling active (%lu Hz)\n",
+            (unsigned long)ADC_SAMPLE_RATE_HZ);
+    } else {
+        debugPrintf("PressureManager: high-rate sampling unavailable, using polled mode\n");
+    }
+}
+
+bool PressureManager::beginHighRateSampling() {
+#ifdef ARDUINO_ARCH_RENESAS_UNO
+    s_adcIsrManager = this;
+
+    uint8_t timerType = GPT_TIMER;
+    int8_t timerChannel = FspTimer::get_available_timer(timerType);
+    if (timerChannel < 0) {
+        // No free GPT - AGT channels are acceptable for a 1 kHz tick
+        timerChannel = FspTimer::get_available_timer(timerType, true);
+    }
+    if (timerChannel < 0) {
+        return false;
+    }
+
+    if (!adcSampleTimer.begin(TIMER_MODE_PERIODIC, timerType, timerChannel,
+                              (float)ADC_SAMPLE_RATE_HZ, 50.0f, adcSampleIsr)) {
+        return false;
+    }
+    if (!adcSampleTimer.setup_overflow_irq()) {
+        return false;
+    }
+    if (!adcSampleTimer.open()) {
+        return false;
+    }
+    if (!adcSampleTimer.start()) {
+        return false;
+    }
+
+    for (int i = 0; i < SENSOR_COUNT; i++) {
+        sensors[i].setHighRateSampling(true);
+    }
+    return true;
+#else
+    return false;  // Non-Renesas build: keep the polled sampling path
+#endif
 }
 
 void PressureManager::update() {
@@ -173,30 +337,46 @@ void PressureManager::update() {
     for (int i = 0; i < SENSOR_COUNT; i++) {
         sensors[i].update();
     }
-    
-    // Publish pressures periodically
+
+    // Change-driven publishing per channel: a move past the deadband sends
+    // immediately (capped at the min interval, so an active split produces
+    // a pressure curve at task-cadence granularity); a static value falls
+    // back to the keepalive so the receiver can tell idle from dead.
     unsigned long now = millis();
-    if (now - lastPublishTime >= publishInterval) {
-        publishPressures();
-        lastPublishTime = now;
+    for (int i = 0; i < SENSOR_COUNT; i++) {
+        if (!sensors[i].isReady()) continue;
+
+        float psi = sensors[i].getPressure();
+        unsigned long sinceLast = now - lastSentMs[i];
+        bool moved = fabsf(psi - lastSentPsi[i]) >= publishDeadbandPsi;
+
+        if ((moved && sinceLast >= publishMinIntervalMs) ||
+            sinceLast >= publishKeepaliveMs) {
+            publishSensor(i, now);
+        }
     }
 }
 
+void PressureManager::publishSensor(int index, unsigned long now) {
+    // Raw ADC-like value (0-1023 range based on voltage), matching the
+    // scaling the fixed-interval publisher always used
+    uint16_t raw = (uint16_t)(sensors[index].getVoltage() / 5.0 * 1023);
+    uint8_t pin = (index == SENSOR_HYDRAULIC) ? A1 : A5;
+
+    telemetryManager.sendPressureReading(pin, sensors[index].getPressure(), raw,
+                                         (uint8_t)index, false);
+
+    lastSentPsi[index] = sensors[index].getPressure();
+    lastSentMs[index] = now;
+}
+
 void PressureManager::publishPressures() {
-    // MQTT publishing removed - non-networking version
-    
-    // Send telemetry for pressure readings
-    float hydraulicPressure = getHydraulicPressure();
-    float hydraulicOilPressure = getHydraulicOilPressure();
-    
-    // Convert pressure to raw ADC-like values (0-1023 range based on voltage)
-    uint16_t hydraulicRaw = (uint16_t)(sensors[SENSOR_HYDRAULIC].getVoltage() / 5.0 * 1023);
-    uint16_t hydraulicOilRaw = (uint16_t)(sensors[SENSOR_HYDRAULIC_OIL].getVoltage() / 5.0 * 1023);
-    
-    telemetryManager.sendPressureReading(A1, hydraulicPressure, hydraulicRaw, SENSOR_HYDRAULIC, false);
-    telemetryManager.sendPressureReading(A5, hydraulicOilPressure, hydraulicOilRaw, SENSOR_HYDRAULIC_OIL, false);
-    
-    // Pressure data available via serial commands
+    // Unconditional send of both channels (used by explicit requests);
+    // resets the adaptive publisher's change/keepalive tracking
+    unsigned long now = millis();
+    for (int i = 0; i < SENSOR_COUNT; i++) {
+        publishSensor(i, now);
+    }
 }
 
 void PressureManager::getStatusString(char* buffer, size_t bufferSize) {
@@ -44,6 +44,10 @@ int PressureSensor::applyFilter(int rawValue) {
             return vals[1]; // Return median
         }
         
+        case FILTER_MEDIAN_N:
+            // Incrementally sorted window - O(log n) insert, see median_filter.h
+            return (int)medianFilter.insert((uint16_t)rawValue);
+
         case FILTER_EMA: {
             if (samplesFilled == 0 && sampleIndex == 0 && emaValue == 0.0f) {
                 emaValue = (float)rawValue;
@@ -139,10 +143,12 @@ void PressureSensor::getStatusString(char* buffer, size_t bufferSize) {
         case FILTER_NONE: filterName = "none"; break;
         case FILTER_MEDIAN3: filterName = "median3"; break;
         case FILTER_EMA: filterName = "ema"; break;
+        case FILTER_MEDIAN_N: filterName = "medianN"; break;
     }
-    
+
     snprintf(buffer, bufferSize,
-        "adcVref=%.6f maxPressurePsi=%.2f sensorGain=%.6f sensorOffset=%.6f filter=%s emaAlpha=%.3f currentPSI=%.2f",
-        adcVref, maxPressurePsi, sensorGain, sensorOffset, filterName, emaAlpha, currentPressure
+        "adcVref=%.6f maxPressurePsi=%.2f sensorGain=%.6f sensorOffset=%.6f filter=%s emaAlpha=%.3f medianWin=%u currentPSI=%.2f",
+        adcVref, maxPressurePsi, sensorGain, sensorOffset, filterName, emaAlpha,
+        (unsigned)medianFilter.getWindowSize(), currentPressure
     );
 }
\ No newline at end of file
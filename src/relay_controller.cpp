@@ -1,6 +1,8 @@
 #include "relay_controller.h"
 #include "system_error_manager.h"
 #include "telemetry_manager.h"
+#include "flight_recorder.h"
+#include "status_cache.h"
 // NetworkManager include removed - non-networking version
 #include "logger.h"
 
@@ -21,112 +23,192 @@ void RelayController::begin() {
     // Power on the relay board (R9 OFF powers on the relay add-on board)
     sendCommand(RELAY_POWER_CONTROL, false);
     boardPowered = true;
-    
+
+    // Pre-format the E-stop cutoff commands so emergencyCutoff() does no
+    // formatting on the fast path (same wire format as sendCommand + println)
+    snprintf(cutoffExtendCmd, sizeof(cutoffExtendCmd), "R%d OFF\r\n", RELAY_EXTEND);
+    snprintf(cutoffRetractCmd, sizeof(cutoffRetractCmd), "R%d OFF\r\n", RELAY_RETRACT);
+
     LOG_INFO("RelayController initialized");
 }
 
+void RelayController::emergencyCutoff() {
+    // Abandon any in-flight response wait - the cutoff goes on the wire
+    // now, and stray "OK" lines are consumed harmlessly
+    waitingForResponse = false;
+
+    Serial1.write((const uint8_t*)cutoffExtendCmd, strlen(cutoffExtendCmd));
+    Serial1.write((const uint8_t*)cutoffRetractCmd, strlen(cutoffRetractCmd));
+
+    relayStates[RELAY_EXTEND] = false;
+    relayStates[RELAY_RETRACT] = false;
+    statusCache.markDirty(STATUS_SECTION_RELAY);
+
+    flightRecorder.record(FLIGHT_RELAY, RELAY_EXTEND, 0);
+    flightRecorder.record(FLIGHT_RELAY, RELAY_RETRACT, 0);
+}
+
 void RelayController::sendCommand(uint8_t relayNumber, bool on) {
     if (relayNumber < 1 || relayNumber > MAX_RELAYS) {
         debugPrintf("Invalid relay number: %d\n", relayNumber);
         return;
     }
-    
+
     char command[16];
     snprintf(command, sizeof(command), "R%d %s", relayNumber, on ? "ON" : "OFF");
-    
+
     Serial1.println(command);
     lastCommandTime = millis();
     waitingForResponse = true;
-    
+    responseLinePos = 0;
+
     debugPrintf("Relay cmd -> %s\n", command);
-    
+
     // Update power state tracking
     if (relayNumber == RELAY_POWER_CONTROL) {
         boardPowered = on;
     }
 }
 
-bool RelayController::sendCommandWithRetry(uint8_t relayNumber, bool on) {
-    retryCount = 0;
-    lastRelayNumber = relayNumber;
-    lastRelayState = on;
-    
-    while (retryCount <= MAX_RETRIES) {
-        sendCommand(relayNumber, on);
-        
-        if (waitForOkResponse()) {
-            return true; // Success
+bool RelayController::enqueueCommand(uint8_t relayNumber, bool on, bool isManual, bool priority) {
+    if (queueCount >= COMMAND_QUEUE_SIZE) {
+        if (priority) {
+            // Never drop a safety cutoff: evict the newest queued entry
+            // instead - it is the least consequential to lose, and the
+            // state machine that issued it re-commands on its next pass
+            uint8_t newest = (queueHead + queueCount - 1) % COMMAND_QUEUE_SIZE;
+            LOG_WARN("Relay queue full - evicting R%d %s for safety cutoff R%d",
+                     commandQueue[newest].relayNumber,
+                     commandQueue[newest].on ? "ON" : "OFF", relayNumber);
+            queueCount--;
+        } else {
+            LOG_ERROR("Relay command queue full - R%d %s dropped", relayNumber, on ? "ON" : "OFF");
+            if (errorManager) {
+                errorManager->setError(ERROR_HARDWARE_FAULT, "Relay command queue overflow");
+            }
+            return false;
         }
-        
-        retryCount++;
-        if (retryCount <= MAX_RETRIES) {
-            debugPrintf("Relay R%d command failed, retry %d/%d\n", relayNumber, retryCount, MAX_RETRIES);
-            delay(100); // Brief delay before retry
+    }
+
+    if (priority) {
+        // Safety-critical cutoffs jump the queue: insert at head, and if a
+        // non-critical command is awaiting its response, abandon that wait so
+        // the cutoff goes on the wire this pass (responses are plain "OK"
+        // lines, so the stale ack is consumed harmlessly)
+        if (waitingForResponse) {
+            debugPrintf("Relay: preempting in-flight R%d for safety cutoff R%d\n",
+                       lastRelayNumber, relayNumber);
+            waitingForResponse = false;
         }
+        queueHead = (queueHead + COMMAND_QUEUE_SIZE - 1) % COMMAND_QUEUE_SIZE;
+        commandQueue[queueHead].relayNumber = relayNumber;
+        commandQueue[queueHead].on = on;
+        commandQueue[queueHead].isManual = isManual;
+        queueCount++;
+        // Transmit immediately rather than waiting for the next update() pass
+        transmitNextCommand();
+    } else {
+        uint8_t tail = (queueHead + queueCount) % COMMAND_QUEUE_SIZE;
+        commandQueue[tail].relayNumber = relayNumber;
+        commandQueue[tail].on = on;
+        commandQueue[tail].isManual = isManual;
+        queueCount++;
     }
-    
-    // All retries failed - report critical error
-    LOG_CRITICAL("Relay R%d command failed after %d retries", relayNumber, MAX_RETRIES);
-    if (errorManager) {
-        char errorMsg[64];
-        snprintf(errorMsg, sizeof(errorMsg), "Relay R%d communication timeout", relayNumber);
-        errorManager->setError(ERROR_HARDWARE_FAULT, errorMsg);
+
+    return true;
+}
+
+void RelayController::transmitNextCommand() {
+    if (waitingForResponse || queueCount == 0) {
+        return;
     }
-    
-    return false;
+
+    RelayCommand& cmd = commandQueue[queueHead];
+    queueHead = (queueHead + 1) % COMMAND_QUEUE_SIZE;
+    queueCount--;
+
+    retryCount = 0;
+    lastRelayNumber = cmd.relayNumber;
+    lastRelayState = cmd.on;
+    lastRelayManual = cmd.isManual;
+    sendCommand(cmd.relayNumber, cmd.on);
 }
 
-bool RelayController::waitForOkResponse() {
-    unsigned long startTime = millis();
-    String response = "";
-    
-    while (millis() - startTime < RESPONSE_TIMEOUT_MS) {
-        if (Serial1.available()) {
-            char c = Serial1.read();
-            if (c == '\n') {
-                response.trim();
-                if (response.length() > 0) {
-                    if (response.indexOf("OK") >= 0) {
-                        debugPrintf("Relay response: '%s'\n", response.c_str());
-                        waitingForResponse = false;
-                        return true;
-                    }
-                }
-                response = "";
-            } else if (c != '\r') {
-                response += c;
+void RelayController::processResponseChars() {
+    while (Serial1.available()) {
+        char c = Serial1.read();
+
+        if (c == '\r') continue;
+
+        if (c == '\n') {
+            responseLine[responseLinePos] = '\0';
+            responseLinePos = 0;
+
+            if (waitingForResponse && strstr(responseLine, "OK") != nullptr) {
+                debugPrintf("Relay response: '%s'\n", responseLine);
+                handleCommandConfirmed();
+            } else if (echoEnabled && responseLine[0] != '\0') {
+                // Unexpected relay board output - echo for debugging
+                Serial.print("Relay echo: ");
+                Serial.println(responseLine);
             }
+        } else if (responseLinePos < sizeof(responseLine) - 1) {
+            responseLine[responseLinePos++] = c;
         }
     }
-    
+}
+
+void RelayController::handleCommandConfirmed() {
     waitingForResponse = false;
-    debugPrintf("Relay response timeout (100ms)\n");
-    return false;
+
+    debugPrintf("[RelayController] R%d -> %s %s\n", lastRelayNumber,
+               lastRelayState ? "ON" : "OFF", lastRelayManual ? "(manual)" : "(auto)");
+
+    // Send telemetry for confirmed relay state change
+    Telemetry::RelayType relayType = (Telemetry::RelayType)lastRelayNumber; // Direct mapping for now
+    telemetryManager.sendRelayEvent(lastRelayNumber, lastRelayState, lastRelayManual, true, relayType);
+}
+
+void RelayController::handleResponseTimeout() {
+    retryCount++;
+
+    if (retryCount <= MAX_RETRIES) {
+        debugPrintf("Relay R%d command failed, retry %d/%d\n", lastRelayNumber, retryCount, MAX_RETRIES);
+        sendCommand(lastRelayNumber, lastRelayState);
+        return;
+    }
+
+    // All retries failed - report critical error and move on
+    waitingForResponse = false;
+    LOG_CRITICAL("Relay R%d command failed after %d retries", lastRelayNumber, MAX_RETRIES);
+    if (errorManager) {
+        char errorMsg[64];
+        snprintf(errorMsg, sizeof(errorMsg), "Relay R%d communication timeout", lastRelayNumber);
+        errorManager->setError(ERROR_HARDWARE_FAULT, errorMsg);
+    }
+
+    Telemetry::RelayType relayType = (Telemetry::RelayType)lastRelayNumber;
+    telemetryManager.sendRelayEvent(lastRelayNumber, lastRelayState, lastRelayManual, false, relayType);
 }
 
 void RelayController::ensurePowerOn() {
     if (!boardPowered) {
-        sendCommand(RELAY_POWER_CONTROL, false); // R9 OFF powers on the board
+        enqueueCommand(RELAY_POWER_CONTROL, false, false, false); // R9 OFF powers on the board
         boardPowered = true;
-        delay(100); // Give board time to power up
     }
 }
 
 void RelayController::update() {
-    // Check for timeouts
+    // Match responses to the in-flight command (and echo strays)
+    processResponseChars();
+
+    // Retry or fail the in-flight command on timeout
     if (waitingForResponse && (millis() - lastCommandTime > RESPONSE_TIMEOUT_MS)) {
-        debugPrintf("Relay response timeout (100ms)\n");
-        waitingForResponse = false;
-    }
-    
-    // Echo any unexpected relay board responses for debugging
-    if (echoEnabled && !waitingForResponse && Serial1.available()) {
-        Serial.print("Relay echo: ");
-        while (Serial1.available()) {
-            Serial.write(Serial1.read());
-        }
-        Serial.println();
+        handleResponseTimeout();
     }
+
+    // Transmit the next queued command when the line is free
+    transmitNextCommand();
 }
 
 void RelayController::setRelay(uint8_t relayNumber, bool on) {
@@ -159,19 +241,34 @@ void RelayController::setRelay(uint8_t relayNumber, bool on, bool isManualComman
     if (relayNumber != RELAY_POWER_CONTROL) {
         ensurePowerOn();
     }
-    
-    // Send command with retries
-    if (sendCommandWithRetry(relayNumber, on)) {
-        relayStates[relayNumber] = on;
-        debugPrintf("[RelayController] R%d -> %s %s\n", relayNumber, on ? "ON" : "OFF", 
-                   isManualCommand ? "(manual)" : "(auto)");
-        
-        // Send telemetry for relay state change
-        Telemetry::RelayType relayType = (Telemetry::RelayType)relayNumber; // Direct mapping for now
-        telemetryManager.sendRelayEvent(relayNumber, on, isManualCommand, true, relayType);
+
+    // Safety-critical cutoffs jump the queue: hydraulic extend/retract
+    // OFF, and engine stop (R8 OFF - the relay is energized while the
+    // engine runs). Priority also guarantees these are never the entry
+    // rejected at a full queue.
+    bool priority = !on && (relayNumber == RELAY_EXTEND || relayNumber == RELAY_RETRACT ||
+                            relayNumber == RELAY_ENGINE_STOP);
+
+    // Enqueue and return immediately; update() handles transmit, response
+    // matching, and retries without blocking the control loop
+    if (enqueueCommand(relayNumber, on, isManualCommand, priority)) {
+        relayStates[relayNumber] = on; // Commanded state (confirmed asynchronously)
+        statusCache.markDirty(STATUS_SECTION_RELAY);
+        flightRecorder.record(FLIGHT_RELAY, relayNumber,
+            (uint16_t)((on ? 1 : 0) | (isManualCommand ? 2 : 0)));
     } else {
-        debugPrintf("Failed to set relay R%d to %s - state not updated\n", relayNumber, on ? "ON" : "OFF");
+        debugPrintf("Failed to queue relay R%d %s - state not updated\n", relayNumber, on ? "ON" : "OFF");
+    }
+}
+
+bool RelayController::resendRelayState(uint8_t relayNumber) {
+    if (relayNumber < 1 || relayNumber > MAX_RELAYS) {
+        return false;
     }
+    // Bypass the already-in-state dedup in setRelay() so the command
+    // actually transmits even though nothing moves - the relay benchmark
+    // needs a real enqueue -> wire -> "OK" round-trip to time
+    return enqueueCommand(relayNumber, relayStates[relayNumber], false, false);
 }
 
 bool RelayController::getRelayState(uint8_t relayNumber) const {
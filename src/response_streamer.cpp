@@ -0,0 +1,59 @@
+#include "response_streamer.h"
+
+#include <stdarg.h>
+#include <string.h>
+
+static const size_t STREAM_MASK = 511;  // STREAM_BUFFER_SIZE - 1
+
+size_t ResponseStreamer::write(const char* text) {
+    return write(text, strlen(text));
+}
+
+size_t ResponseStreamer::write(const char* data, size_t length) {
+    size_t accepted = 0;
+    for (size_t i = 0; i < length; i++) {
+        size_t nextHead = (head + 1) & STREAM_MASK;
+        if (nextHead == tail) {
+            // Ring full - drop the remainder rather than block the handler
+            droppedBytes += (uint32_t)(length - i);
+            break;
+        }
+        buffer[head] = (uint8_t)data[i];
+        head = nextHead;
+        accepted++;
+    }
+    return accepted;
+}
+
+void ResponseStreamer::printf(const char* fmt, ...) {
+    char fragment[160];
+    va_list args;
+    va_start(args, fmt);
+    int len = vsnprintf(fragment, sizeof(fragment), fmt, args);
+    va_end(args);
+    if (len <= 0) return;
+    if ((size_t)len >= sizeof(fragment)) len = sizeof(fragment) - 1;
+    write(fragment, (size_t)len);
+}
+
+void ResponseStreamer::update() {
+    if (head == tail) return;
+
+    // Only hand the UART what it can buffer right now - never block here
+    int room = Serial.availableForWrite();
+    while (room > 0 && tail != head) {
+        // Contiguous run up to the wrap point or producer head
+        size_t end = (tail < head) ? head : STREAM_MASK + 1;
+        size_t chunk = end - tail;
+        if (chunk > (size_t)room) chunk = (size_t)room;
+
+        size_t written = Serial.write(&buffer[tail], chunk);
+        tail = (tail + written) & STREAM_MASK;
+        room -= (int)written;
+        if (written < chunk) break;  // TX buffer filled mid-chunk
+    }
+}
+
+size_t ResponseStreamer::pending() const {
+    return (head - tail) & STREAM_MASK;
+}
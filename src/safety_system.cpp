@@ -3,6 +3,7 @@
 #include "telemetry_manager.h"
 // NetworkManager include removed - non-networking version
 #include "sequence_controller.h"
+#include "flight_recorder.h"
 #include "logger.h"
 
 extern void debugPrintf(const char* fmt, ...);
@@ -47,7 +48,17 @@ void SafetySystem::setEngineStop(bool stop) {
 
 void SafetySystem::update(float currentPressure) {
     lastPressure = currentPressure;
-    
+
+    // Decimated pressure trail for the flight recorder - gives the dump a
+    // pressure history leading into whatever tripped
+    unsigned long now = millis();
+    if (now - lastFlightPressureMs >= 250) {
+        lastFlightPressureMs = now;
+        uint16_t psi = (currentPressure < 0.0f) ? 0
+            : (currentPressure > 65535.0f) ? 65535 : (uint16_t)currentPressure;
+        flightRecorder.record(FLIGHT_PRESSURE, 0, psi);
+    }
+
     // Check if cylinder is at end-of-travel (limit switches)
     extern bool g_limitExtendActive;
     extern bool g_limitRetractActive;
@@ -126,7 +137,8 @@ void SafetySystem::activate(const char* reason) {
     
     // Send telemetry for safety activation
     telemetryManager.sendSafetyEvent(1, true); // 1 = safety activation event
-    
+    flightRecorder.record(FLIGHT_SAFETY, 1, (uint16_t)lastPressure);
+
     // Emergency stop sequence
     emergencyStop(reason);
     
@@ -165,6 +177,30 @@ void SafetySystem::emergencyStop(const char* reason) {
     Serial.print("EMERGENCY STOP: ");
     Serial.println(reason ? reason : "unknown");
     Serial.println("Manual relay control still available for pressure relief");
+
+    // Record the stop itself, then stream the event history that led here
+    flightRecorder.record(FLIGHT_SAFETY, 3, (uint16_t)lastPressure);
+    flightRecorder.dump(reason ? reason : "emergency_stop");
+}
+
+void SafetySystem::notifyOverpressureTrip(float pressure, uint16_t tripLatencyUs) {
+    lastPressure = pressure;
+    lastOverpressureLatencyUs = tripLatencyUs;
+    markPressureLimitUsed();
+
+    LOG_CRITICAL("OVERPRESSURE: raw comparator trip at %.1f PSI - relays cut in %uus",
+                 pressure, (unsigned)tripLatencyUs);
+
+    // Event 3 = raw overpressure comparator, latency piggybacked on the event
+    telemetryManager.sendSafetyEvent(3, true, tripLatencyUs);
+    flightRecorder.record(FLIGHT_SAFETY, 4, (uint16_t)pressure);
+
+    // Latched handling through the normal emergency path; the comparator
+    // re-arms only after the operator clears this state
+    if (!safetyActive) {
+        safetyActive = true;
+        emergencyStop("overpressure_comparator");
+    }
 }
 
 void SafetySystem::activateEStop() {
@@ -177,7 +213,8 @@ void SafetySystem::activateEStop() {
     
     // Send telemetry for e-stop activation
     telemetryManager.sendSafetyEvent(2, true); // 2 = e-stop activation event
-    
+    flightRecorder.record(FLIGHT_SAFETY, 2, (uint16_t)lastPressure);
+
     // Emergency stop sequence with E-stop specific handling
     emergencyStop("e_stop_pressed");
     
@@ -0,0 +1,46 @@
+#include "scratch_arena.h"
+
+char* ScratchArena::acquire() {
+    // Short critical section: the mask is the only shared state, and the
+    // interrupt-driven paths may acquire from callback context
+    noInterrupts();
+    for (uint8_t i = 0; i < SCRATCH_SLOT_COUNT; i++) {
+        uint8_t bit = (uint8_t)(1 << i);
+        if (!(inUseMask & bit)) {
+            inUseMask |= bit;
+            uint8_t used = (uint8_t)__builtin_popcount(inUseMask);
+            if (used > peakInUse) peakInUse = used;
+            interrupts();
+            return slots[i];
+        }
+    }
+
+    // Every slot taken - count it and let the caller degrade gracefully
+    overflowCount++;
+    interrupts();
+    return nullptr;
+}
+
+void ScratchArena::release(char* buffer) {
+    if (!buffer) return;
+
+    for (uint8_t i = 0; i < SCRATCH_SLOT_COUNT; i++) {
+        if (buffer == slots[i]) {
+            noInterrupts();
+            inUseMask &= (uint8_t)~(1 << i);
+            interrupts();
+            return;
+        }
+    }
+    // Not an arena pointer - nothing to do
+}
+
+uint8_t ScratchArena::slotsInUse() const {
+    return (uint8_t)__builtin_popcount(inUseMask);
+}
+
+ScratchBuffer::ScratchBuffer() : buf(scratchArena.acquire()) {}
+
+ScratchBuffer::~ScratchBuffer() {
+    scratchArena.release(buf);
+}
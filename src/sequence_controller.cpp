@@ -5,6 +5,8 @@
 #include "input_manager.h"
 #include "safety_system.h"
 #include "telemetry_manager.h"
+#include "flight_recorder.h"
+#include "status_cache.h"
 #include "logger.h"
 #include "constants.h"
 
@@ -21,12 +23,16 @@ extern PressureManager pressureManager;
 void SequenceController::enterState(SequenceState newState) {
     if (currentState != newState) {
         debugPrintf("[SEQ] State change: %d -> %d (type: %d)\n", (int)currentState, (int)newState, (int)sequenceType);
-        
+
         // Send telemetry for sequence state change
         telemetryManager.sendSequenceEvent((uint8_t)newState, 0, (uint16_t)(millis() - stateEntryTime));
-        
+        flightRecorder.record(FLIGHT_SEQ_STATE, (uint8_t)newState, (uint16_t)currentState);
+
+        SequenceState oldState = currentState;
         currentState = newState;
         stateEntryTime = millis();
+        noteCycleTransition(oldState, newState, stateEntryTime);
+        statusCache.markDirty(STATUS_SECTION_SEQUENCE);
         
         // Reset limit change timer on state entry
         lastLimitChangeTime = 0;
@@ -82,7 +88,11 @@ void SequenceController::abortSequence(const char* reason) {
         g_relayController->setRelay(RELAY_EXTEND, false);
         g_relayController->setRelay(RELAY_RETRACT, false);
     }
-    
+
+    // Mark the in-flight cycle aborted so the IDLE transition counts it
+    // instead of folding a partial stage into the timing statistics
+    cycleAbortPending = true;
+
     // Reset state
     sequenceType = SEQ_TYPE_AUTOMATIC;
     enterState(SEQ_IDLE);
@@ -131,11 +141,14 @@ unsigned long SequenceController::getElapsedTime() const {
 
 void SequenceController::update() {
     unsigned long now = millis();
-    
+
     // Check for overall timeout
     if (checkTimeout()) {
         return; // Already aborted
     }
+
+    // Track peak hydraulic pressure while a cycle stage is running
+    sampleStagePressure();
     
     // Handle pending press timeout
     if (pendingPressPin > 0 && pendingPressTime > 0) {
@@ -596,4 +609,120 @@ void SequenceController::handleManualRetract() {
 void SequenceController::checkManualStopConditions() {
     // This method can be expanded later for additional stop conditions
     // For now, limits and timeouts are handled in the individual handlers
+}
+
+// Cycle statistics engine
+
+static inline bool isStage1State(SequenceState s) {
+    return s == SEQ_STAGE1_ACTIVE || s == SEQ_STAGE1_WAIT_LIMIT;
+}
+
+static inline bool isStage2State(SequenceState s) {
+    return s == SEQ_STAGE2_ACTIVE || s == SEQ_STAGE2_WAIT_LIMIT;
+}
+
+void SequenceController::sampleStagePressure() {
+    if (!isStage1State(currentState) && !isStage2State(currentState)) return;
+    if (!pressureManager.isReady()) return;
+
+    float psi = pressureManager.getHydraulicPressure();
+    if (psi > stagePeakPsi) stagePeakPsi = psi;
+    if (psi > cyclePeakPsi) cyclePeakPsi = psi;
+}
+
+void SequenceController::closeStage(uint8_t stageIdx, unsigned long now) {
+    unsigned long elapsed = now - stageStartMs;
+    uint16_t elapsedMs = (elapsed > 0xFFFF) ? 0xFFFF : (uint16_t)elapsed;
+
+    StageCycleStats& s = stageStats[stageIdx];
+    s.lastMs = elapsedMs;
+    if (s.count == 0 || elapsedMs < s.minMs) s.minMs = elapsedMs;
+    if (elapsedMs > s.maxMs) s.maxMs = elapsedMs;
+    s.sumMs += elapsedMs;
+    s.count++;
+    s.lastPeakPsi = stagePeakPsi;
+    if (stagePeakPsi > s.maxPeakPsi) s.maxPeakPsi = stagePeakPsi;
+}
+
+void SequenceController::noteCycleTransition(SequenceState oldState, SequenceState newState, unsigned long now) {
+    // Stage boundaries only matter for the automatic extend->retract cycle;
+    // manual jogs have no defined stage duration worth trending
+    if (newState == SEQ_STAGE1_ACTIVE) {
+        // Cycle start: reset per-run tracking
+        stageStartMs = now;
+        stagePeakPsi = 0.0f;
+        cyclePeakPsi = 0.0f;
+        cycleAbortPending = false;
+    } else if (newState == SEQ_STAGE2_ACTIVE && isStage1State(oldState)) {
+        // Extend stage finished, retract stage begins
+        closeStage(0, now);
+        stageStartMs = now;
+        stagePeakPsi = 0.0f;
+    } else if (newState == SEQ_IDLE) {
+        if (cycleAbortPending) {
+            // Partial cycle: count it but keep its times out of the aggregates
+            if (isStage1State(oldState) || isStage2State(oldState) ||
+                oldState == SEQ_WAIT_START_DEBOUNCE) {
+                cyclesAborted++;
+            }
+        } else if (isStage2State(oldState)) {
+            // Normal completion: close retract stage and record the cycle
+            closeStage(1, now);
+            cyclesCompleted++;
+
+            CycleRecord& rec = recentCycles[cycleRingHead];
+            rec.stage1Ms = stageStats[0].lastMs;
+            rec.stage2Ms = stageStats[1].lastMs;
+            rec.peakPsi = cyclePeakPsi;
+            cycleRingHead = (cycleRingHead + 1) % CYCLE_RING_SIZE;
+            if (cycleRingCount < CYCLE_RING_SIZE) cycleRingCount++;
+
+            publishCycleStats();
+        }
+        cycleAbortPending = false;
+    }
+}
+
+void SequenceController::getCycleStatsString(char* buffer, size_t bufferSize) {
+    const StageCycleStats& s1 = stageStats[0];
+    const StageCycleStats& s2 = stageStats[1];
+    uint16_t s1Mean = s1.count ? (uint16_t)(s1.sumMs / s1.count) : 0;
+    uint16_t s2Mean = s2.count ? (uint16_t)(s2.sumMs / s2.count) : 0;
+
+    int len = snprintf(buffer, bufferSize,
+        "cycles=%lu aborted=%lu "
+        "ext last=%ums min=%ums max=%ums mean=%ums peak=%.0f/%.0fpsi "
+        "ret last=%ums min=%ums max=%ums mean=%ums peak=%.0f/%.0fpsi recent=",
+        (unsigned long)cyclesCompleted, (unsigned long)cyclesAborted,
+        s1.lastMs, s1.minMs, s1.maxMs, s1Mean, s1.lastPeakPsi, s1.maxPeakPsi,
+        s2.lastMs, s2.minMs, s2.maxMs, s2Mean, s2.lastPeakPsi, s2.maxPeakPsi);
+
+    // Append the recent-cycle ring, newest first: ext+ret@peak
+    for (uint8_t i = 0; i < cycleRingCount && len > 0 && (size_t)len < bufferSize; i++) {
+        uint8_t idx = (cycleRingHead + CYCLE_RING_SIZE - 1 - i) % CYCLE_RING_SIZE;
+        len += snprintf(buffer + len, bufferSize - len, "%s%u+%u@%.0f",
+                        (i > 0) ? "," : "",
+                        recentCycles[idx].stage1Ms, recentCycles[idx].stage2Ms,
+                        recentCycles[idx].peakPsi);
+    }
+}
+
+void SequenceController::publishCycleStats() {
+    const StageCycleStats& s1 = stageStats[0];
+    const StageCycleStats& s2 = stageStats[1];
+
+    // Per-stage fields packed as uint16: last/min/max/mean ms, then
+    // last/max peak pressure in 0.1 PSI steps
+    uint16_t stage1[6] = {
+        s1.lastMs, s1.minMs, s1.maxMs,
+        (uint16_t)(s1.count ? s1.sumMs / s1.count : 0),
+        (uint16_t)(s1.lastPeakPsi * 10.0f), (uint16_t)(s1.maxPeakPsi * 10.0f)
+    };
+    uint16_t stage2[6] = {
+        s2.lastMs, s2.minMs, s2.maxMs,
+        (uint16_t)(s2.count ? s2.sumMs / s2.count : 0),
+        (uint16_t)(s2.lastPeakPsi * 10.0f), (uint16_t)(s2.maxPeakPsi * 10.0f)
+    };
+
+    telemetryManager.sendCycleStats(cyclesCompleted, cyclesAborted, stage1, stage2);
 }
\ No newline at end of file
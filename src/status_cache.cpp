@@ -0,0 +1,102 @@
+#include "status_cache.h"
+#include "pressure_manager.h"
+#include "sequence_controller.h"
+#include "relay_controller.h"
+#include "safety_system.h"
+#include "system_error_manager.h"
+
+void StatusCache::begin() {
+    pressureBuf[0] = sequenceBuf[0] = relayBuf[0] = safetyBuf[0] = errorBuf[0] = '\0';
+
+    // Prime every section so the first "show" never sees an empty cache
+    for (uint8_t s = 0; s < STATUS_SECTION_COUNT; s++) {
+        refreshSection((StatusSection)s);
+    }
+    dirtyMask = 0;
+    lastAnalogRefresh = millis();
+}
+
+void StatusCache::update() {
+    // Pressure and safety sections embed live analog values; dirty them at
+    // display resolution rather than on every sample
+    unsigned long now = millis();
+    if (now - lastAnalogRefresh >= ANALOG_REFRESH_MS) {
+        lastAnalogRefresh = now;
+        markDirty(STATUS_SECTION_PRESSURE);
+        markDirty(STATUS_SECTION_SAFETY);
+    }
+
+    if (dirtyMask == 0) return;
+
+    // Reformat exactly one dirty section per pass - bounded snprintf work
+    for (uint8_t s = 0; s < STATUS_SECTION_COUNT; s++) {
+        uint8_t bit = (uint8_t)(1 << s);
+        if (dirtyMask & bit) {
+            dirtyMask &= (uint8_t)~bit;
+            refreshSection((StatusSection)s);
+            return;
+        }
+    }
+}
+
+void StatusCache::refreshSection(StatusSection section) {
+    switch (section) {
+        case STATUS_SECTION_PRESSURE:
+            if (pressureManager) {
+                pressureManager->getStatusString(pressureBuf, sizeof(pressureBuf));
+                if (pressureBuf[0] == '\0') {
+                    snprintf(pressureBuf, sizeof(pressureBuf), "pressure=NONE");
+                }
+            } else {
+                snprintf(pressureBuf, sizeof(pressureBuf), "pressure=NO_MANAGER");
+            }
+            break;
+
+        case STATUS_SECTION_SEQUENCE:
+            if (sequenceController) {
+                sequenceController->getStatusString(sequenceBuf, sizeof(sequenceBuf));
+            }
+            break;
+
+        case STATUS_SECTION_RELAY:
+            if (relayController) {
+                relayController->getStatusString(relayBuf, sizeof(relayBuf));
+            }
+            break;
+
+        case STATUS_SECTION_SAFETY:
+            if (safetySystem) {
+                safetySystem->getStatusString(safetyBuf, sizeof(safetyBuf));
+            }
+            break;
+
+        case STATUS_SECTION_ERRORS:
+            if (systemErrorManager) {
+                int errorCount = systemErrorManager->getActiveErrorCount();
+                const char* ledPattern = systemErrorManager->getCurrentLedPatternString();
+                snprintf(errorBuf, sizeof(errorBuf), "errors=%d led=%s", errorCount, ledPattern);
+            } else {
+                snprintf(errorBuf, sizeof(errorBuf), "errors=0");
+            }
+            break;
+
+        default:
+            break;
+    }
+}
+
+const char* StatusCache::getSection(StatusSection section) const {
+    switch (section) {
+        case STATUS_SECTION_PRESSURE: return pressureBuf;
+        case STATUS_SECTION_SEQUENCE: return sequenceBuf;
+        case STATUS_SECTION_RELAY:    return relayBuf;
+        case STATUS_SECTION_SAFETY:   return safetyBuf;
+        case STATUS_SECTION_ERRORS:   return errorBuf;
+        default:                      return "";
+    }
+}
+
+void StatusCache::getStatusLine(char* buffer, size_t bufferSize) {
+    snprintf(buffer, bufferSize, "%s %s %s %s %s",
+             pressureBuf, sequenceBuf, relayBuf, safetyBuf, errorBuf);
+}
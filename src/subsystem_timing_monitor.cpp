@@ -1,7 +1,24 @@
 #include "subsystem_timing_monitor.h"
+#include "telemetry_manager.h"
+#include "hardware_watchdog.h"
 #include "constants.h"
 #include <string.h>
 
+// Map a duration to its log2 histogram bucket: index of the highest set
+// bit, clamped to the open-ended top bucket. Single clz instruction on
+// Cortex-M4, so the per-call cost stays at a couple of reads + increment.
+static inline uint8_t durationBucket(unsigned long durationUs) {
+    if (durationUs == 0) return 0;
+    uint8_t bucket = (uint8_t)(31 - __builtin_clz((uint32_t)durationUs));
+    return (bucket < TIMING_HISTOGRAM_BUCKETS) ? bucket : (uint8_t)(TIMING_HISTOGRAM_BUCKETS - 1);
+}
+
+// Upper bound of a bucket in microseconds (used when reporting percentiles)
+static inline unsigned long bucketUpperBoundUs(uint8_t bucket) {
+    if (bucket >= 31) return 0xFFFFFFFFUL;
+    return 1UL << (bucket + 1);
+}
+
 SubsystemTimingMonitor::SubsystemTimingMonitor() :
     detailedLoggingEnabled(false),
     lastReportTime(0),
@@ -39,6 +56,7 @@ void SubsystemTimingMonitor::initializeSubsystemData() {
         "InputManager",
         "SystemErrorManager",
         "SafetySystem",
+        "TelemetryManager",
         "CommandProcessing_Serial",
         "MainLoop_Total"
     };
@@ -52,7 +70,12 @@ void SubsystemTimingMonitor::initializeSubsystemData() {
         timings[i].lastCallTime = 0;
         timings[i].isActive = false;
         timings[i].startTime = 0;
+        memset(timings[i].histogram, 0, sizeof(timings[i].histogram));
     }
+
+    memset(&loopStats, 0, sizeof(loopStats));
+    loopStats.outlierThresholdUs = 20000;  // 20 ms - well past a healthy pass
+    loopStats.lastOutlierSubsystem = 0xFF;
 }
 
 void SubsystemTimingMonitor::setThreshold(SubsystemID subsystem, unsigned long warningMs, unsigned long criticalMs) {
@@ -78,43 +101,66 @@ void SubsystemTimingMonitor::startTiming(SubsystemID subsystem) {
     int idx = static_cast<int>(subsystem);
     if (idx < static_cast<int>(SubsystemID::COUNT)) {
         timings[idx].isActive = true;
-        timings[idx].startTime = millis();
+        timings[idx].startTime = micros();
+        // Crash breadcrumb: if the watchdog fires, this identifies which
+        // subsystem hung (read back after the reset)
+        HardwareWatchdog::noteSubsystemEntry((uint8_t)idx);
     }
 }
 
 void SubsystemTimingMonitor::endTiming(SubsystemID subsystem) {
-    unsigned long endTime = millis();
+    unsigned long endTime = micros();
     int idx = static_cast<int>(subsystem);
-    
+
     if (idx >= static_cast<int>(SubsystemID::COUNT) || !timings[idx].isActive) {
         return;
     }
-    
+
     timings[idx].isActive = false;
-    unsigned long duration = endTime - timings[idx].startTime;
-    
+    unsigned long duration = endTime - timings[idx].startTime;  // us, wrap-safe
+
     // Update statistics
     timings[idx].totalTime += duration;
     timings[idx].callCount++;
     timings[idx].lastCallTime = duration;
-    
+    timings[idx].histogram[durationBucket(duration)]++;
+
     if (duration > timings[idx].maxTime) {
         timings[idx].maxTime = duration;
     }
-    
-    // Check thresholds
+
+    // Check thresholds (configured in ms, duration is us)
     TimingThresholds& thresholds = subsystemThresholds[idx];
-    
-    if (duration >= thresholds.criticalThreshold) {
+
+    if (duration >= thresholds.criticalThreshold * 1000UL) {
         logCritical(subsystem, duration);
-    } else if (duration >= thresholds.warningThreshold) {
+    } else if (duration >= thresholds.warningThreshold * 1000UL) {
         timings[idx].warningCount++;
         logWarning(subsystem, duration);
     } else if (detailedLoggingEnabled) {
-        LOG_DEBUG("%s completed in %lums", timings[idx].name, duration);
+        LOG_DEBUG("%s completed in %luus", timings[idx].name, duration);
     }
 }
 
+unsigned long SubsystemTimingMonitor::getPercentileUs(SubsystemID subsystem, uint8_t percentile) {
+    int idx = static_cast<int>(subsystem);
+    if (idx >= static_cast<int>(SubsystemID::COUNT) || timings[idx].callCount == 0) {
+        return 0;
+    }
+
+    // Walk the cumulative histogram until we pass the target sample count;
+    // report the containing bucket's upper bound
+    unsigned long target = ((uint64_t)timings[idx].callCount * percentile + 99) / 100;
+    unsigned long cumulative = 0;
+    for (uint8_t b = 0; b < TIMING_HISTOGRAM_BUCKETS; b++) {
+        cumulative += timings[idx].histogram[b];
+        if (cumulative >= target) {
+            return bucketUpperBoundUs(b);
+        }
+    }
+    return timings[idx].maxTime;
+}
+
 // Automatic timing scope implementation
 SubsystemTimingMonitor::TimingScope::TimingScope(SubsystemTimingMonitor* mon, SubsystemID sub) :
     monitor(mon), subsystem(sub) {
@@ -136,16 +182,17 @@ void SubsystemTimingMonitor::getTimingReport(char* buffer, size_t bufferSize) {
     
     for (int i = 0; i < static_cast<int>(SubsystemID::COUNT); i++) {
         if (timings[i].callCount > 0) {
-            unsigned long avgTime = timings[i].totalTime / timings[i].callCount;
+            SubsystemID id = static_cast<SubsystemID>(i);
             offset += snprintf(buffer + offset, bufferSize - offset,
-                "%s: calls=%lu avg=%lums max=%lums last=%lums warns=%lu\\n",
+                "%s: calls=%lu p50=%luus p95=%luus p99=%luus max=%luus warns=%lu\\n",
                 timings[i].name,
                 timings[i].callCount,
-                avgTime,
+                getPercentileUs(id, 50),
+                getPercentileUs(id, 95),
+                getPercentileUs(id, 99),
                 timings[i].maxTime,
-                timings[i].lastCallTime,
                 timings[i].warningCount);
-            
+
             if (offset >= bufferSize - 100) break; // Prevent buffer overflow
         }
     }
@@ -160,11 +207,13 @@ void SubsystemTimingMonitor::getSubsystemStatus(SubsystemID subsystem, char* buf
     
     SubsystemTiming& timing = timings[idx];
     if (timing.callCount > 0) {
-        unsigned long avgTime = timing.totalTime / timing.callCount;
         snprintf(buffer, bufferSize,
-            "%s: %lu calls, avg %lums, max %lums, last %lums, %lu warnings",
-            timing.name, timing.callCount, avgTime, timing.maxTime, 
-            timing.lastCallTime, timing.warningCount);
+            "%s: %lu calls, p50 %luus, p95 %luus, p99 %luus, max %luus, %lu warnings",
+            timing.name, timing.callCount,
+            getPercentileUs(subsystem, 50),
+            getPercentileUs(subsystem, 95),
+            getPercentileUs(subsystem, 99),
+            timing.maxTime, timing.warningCount);
     } else {
         snprintf(buffer, bufferSize, "%s: No calls recorded", timing.name);
     }
@@ -175,10 +224,12 @@ void SubsystemTimingMonitor::logTimingReport() {
     
     for (int i = 0; i < static_cast<int>(SubsystemID::COUNT); i++) {
         if (timings[i].callCount > 0) {
-            unsigned long avgTime = timings[i].totalTime / timings[i].callCount;
-            LOG_INFO("%s: calls=%lu avg=%lums max=%lums warns=%lu",
-                timings[i].name, timings[i].callCount, avgTime, 
-                timings[i].maxTime, timings[i].warningCount);
+            SubsystemID id = static_cast<SubsystemID>(i);
+            LOG_INFO("%s: calls=%lu p50=%luus p95=%luus p99=%luus max=%luus warns=%lu",
+                timings[i].name, timings[i].callCount,
+                getPercentileUs(id, 50), getPercentileUs(id, 95),
+                getPercentileUs(id, 99), timings[i].maxTime,
+                timings[i].warningCount);
         }
     }
 }
@@ -192,20 +243,29 @@ void SubsystemTimingMonitor::resetStatistics() {
         timings[i].lastCallTime = 0;
         timings[i].isActive = false;
         timings[i].startTime = 0;
+        memset(timings[i].histogram, 0, sizeof(timings[i].histogram));
     }
+
+    // Loop jitter stats reset with everything else; the configured outlier
+    // threshold survives
+    unsigned long threshold = loopStats.outlierThresholdUs;
+    memset(&loopStats, 0, sizeof(loopStats));
+    loopStats.outlierThresholdUs = threshold;
+    loopStats.lastOutlierSubsystem = 0xFF;
+
     LOG_INFO("Subsystem timing statistics reset");
 }
 
 void SubsystemTimingMonitor::analyzeTimeout(char* analysis, size_t bufferSize) {
     SubsystemID slowest = getSlowestSubsystem();
     int slowestIdx = static_cast<int>(slowest);
-    
-    unsigned long totalTime = getTotalExecutionTime();
-    
+
+    unsigned long totalMs = (unsigned long)(getTotalExecutionTime() / 1000);
+
     snprintf(analysis, bufferSize,
-        "TIMEOUT ANALYSIS: Total execution %lums. Slowest: %s (max %lums, last %lums, %lu warnings). "
+        "TIMEOUT ANALYSIS: Total execution %lums. Slowest: %s (max %luus, last %luus, %lu warnings). "
         "Active subsystems: ",
-        totalTime, timings[slowestIdx].name, timings[slowestIdx].maxTime,
+        totalMs, timings[slowestIdx].name, timings[slowestIdx].maxTime,
         timings[slowestIdx].lastCallTime, timings[slowestIdx].warningCount);
     
     // Add list of currently active subsystems
@@ -231,8 +291,8 @@ SubsystemID SubsystemTimingMonitor::getSlowestSubsystem() {
     return slowest;
 }
 
-unsigned long SubsystemTimingMonitor::getTotalExecutionTime() {
-    unsigned long total = 0;
+uint64_t SubsystemTimingMonitor::getTotalExecutionTime() {
+    uint64_t total = 0;
     for (int i = 0; i < static_cast<int>(SubsystemID::COUNT); i++) {
         total += timings[i].totalTime;
     }
@@ -250,20 +310,120 @@ bool SubsystemTimingMonitor::hasAnyWarnings() {
 
 bool SubsystemTimingMonitor::hasAnyCriticalIssues() {
     for (int i = 0; i < static_cast<int>(SubsystemID::COUNT); i++) {
-        if (timings[i].maxTime >= subsystemThresholds[i].criticalThreshold) {
+        if (timings[i].maxTime >= subsystemThresholds[i].criticalThreshold * 1000UL) {
             return true;
         }
     }
     return false;
 }
 
+void SubsystemTimingMonitor::publishTimingStats() {
+    for (int i = 0; i < static_cast<int>(SubsystemID::COUNT); i++) {
+        if (timings[i].callCount == 0) continue;
+        SubsystemID id = static_cast<SubsystemID>(i);
+        telemetryManager.sendTimingStats((uint8_t)i,
+            getPercentileUs(id, 50),
+            getPercentileUs(id, 95),
+            getPercentileUs(id, 99),
+            timings[i].maxTime,
+            timings[i].callCount);
+    }
+}
+
+void SubsystemTimingMonitor::noteLoopIteration() {
+    unsigned long now = micros();
+    if (!loopStats.primed) {
+        loopStats.primed = true;
+        loopStats.prevIterationUs = now;
+        return;
+    }
+
+    unsigned long interval = now - loopStats.prevIterationUs;
+    loopStats.prevIterationUs = now;
+
+    loopStats.histogram[durationBucket(interval)]++;
+    loopStats.count++;
+
+    if (interval > loopStats.worstUs) {
+        loopStats.worstUs = interval;
+        loopStats.worstAtMs = millis();
+    }
+
+    if (interval >= loopStats.outlierThresholdUs) {
+        loopStats.outlierCount++;
+        loopStats.lastOutlierUs = interval;
+
+        // Attribute the spike: the per-subsystem lastCallTime values are the
+        // durations from the pass that just finished, so the largest one
+        // names the consumer instead of leaving the outlier a mystery
+        uint8_t culprit = 0xFF;
+        unsigned long culpritUs = 0;
+        for (int i = 0; i < static_cast<int>(SubsystemID::COUNT); i++) {
+            if (i == static_cast<int>(SubsystemID::MAIN_LOOP_TOTAL)) continue;
+            if (timings[i].lastCallTime > culpritUs) {
+                culpritUs = timings[i].lastCallTime;
+                culprit = (uint8_t)i;
+            }
+        }
+        loopStats.lastOutlierSubsystem = culprit;
+        loopStats.lastOutlierSubsystemUs = culpritUs;
+
+        LOG_WARN("Loop outlier: %luus pass (threshold %luus) - %s spent %luus",
+                 interval, loopStats.outlierThresholdUs,
+                 (culprit != 0xFF) ? timings[culprit].name : "unattributed",
+                 culpritUs);
+    }
+}
+
+void SubsystemTimingMonitor::getLoopStatsString(char* buffer, size_t bufferSize) {
+    if (loopStats.count == 0) {
+        snprintf(buffer, bufferSize, "loopstats: no samples yet");
+        return;
+    }
+
+    // Percentiles from the cumulative log2 histogram (bucket upper bounds)
+    unsigned long p50 = 0, p99 = 0;
+    unsigned long target50 = ((uint64_t)loopStats.count * 50 + 99) / 100;
+    unsigned long target99 = ((uint64_t)loopStats.count * 99 + 99) / 100;
+    unsigned long cumulative = 0;
+    for (uint8_t b = 0; b < TIMING_HISTOGRAM_BUCKETS; b++) {
+        cumulative += loopStats.histogram[b];
+        if (p50 == 0 && cumulative >= target50) p50 = bucketUpperBoundUs(b);
+        if (cumulative >= target99) { p99 = bucketUpperBoundUs(b); break; }
+    }
+
+    snprintf(buffer, bufferSize,
+             "loops=%lu p50<%luus p99<%luus worst=%luus@%lums outliers=%lu(>=%luus) last=%luus by %s(%luus)",
+             loopStats.count, p50, p99,
+             loopStats.worstUs, loopStats.worstAtMs,
+             loopStats.outlierCount, loopStats.outlierThresholdUs,
+             loopStats.lastOutlierUs,
+             (loopStats.lastOutlierSubsystem != 0xFF)
+                 ? timings[loopStats.lastOutlierSubsystem].name : "none",
+             loopStats.lastOutlierSubsystemUs);
+}
+
+void SubsystemTimingMonitor::publishLoopStats() {
+    if (loopStats.count == 0) return;
+    telemetryManager.sendLoopStats(loopStats.histogram,
+                                   loopStats.count,
+                                   loopStats.worstUs,
+                                   loopStats.outlierCount,
+                                   loopStats.lastOutlierUs,
+                                   loopStats.lastOutlierSubsystem);
+}
+
 void SubsystemTimingMonitor::checkHealthStatus() {
     unsigned long now = millis();
-    
+
     // Periodic reporting
     if (now - lastReportTime >= reportInterval) {
         lastReportTime = now;
-        
+
+        // Trend percentiles off-board as compact binary messages
+        publishTimingStats();
+        publishLoopStats();
+
         if (hasAnyWarnings()) {
             LOG_WARN("Subsystem timing issues detected - generating report");
             logTimingReport();
@@ -286,16 +446,23 @@ const char* SubsystemTimingMonitor::getSubsystemName(SubsystemID subsystem) {
     return "Unknown";
 }
 
+const char* SubsystemTimingMonitor::getSubsystemNameById(uint8_t id) {
+    if (id < static_cast<uint8_t>(SubsystemID::COUNT)) {
+        return timings[id].name;
+    }
+    return "Unknown";
+}
+
 void SubsystemTimingMonitor::logWarning(SubsystemID subsystem, unsigned long duration) {
     TimingThresholds& thresholds = subsystemThresholds[static_cast<int>(subsystem)];
     if (thresholds.enableLogging) {
-        LOG_WARN("%s took %lums (warning threshold: %lums)", 
+        LOG_WARN("%s took %luus (warning threshold: %lums)",
                  getSubsystemName(subsystem), duration, thresholds.warningThreshold);
     }
 }
 
 void SubsystemTimingMonitor::logCritical(SubsystemID subsystem, unsigned long duration) {
     TimingThresholds& thresholds = subsystemThresholds[static_cast<int>(subsystem)];
-    LOG_CRITICAL("%s took %lums (CRITICAL threshold: %lums) - potential system bottleneck", 
+    LOG_CRITICAL("%s took %luus (CRITICAL threshold: %lums) - potential system bottleneck",
                  getSubsystemName(subsystem), duration, thresholds.criticalThreshold);
 }
\ No newline at end of file
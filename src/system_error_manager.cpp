@@ -2,6 +2,7 @@
 // NetworkManager include removed - non-networking version
 #include "logger.h"
 #include "telemetry_manager.h"
+#include "status_cache.h"
 
 extern void debugPrintf(const char* fmt, ...);
 
@@ -25,42 +26,82 @@ void SystemErrorManager::begin() {
     debugPrintf("SystemErrorManager: Initialized with MIL on pin 9 and LED_BUILTIN on pin 13\n");
 }
 
+bool SystemErrorManager::takeToken(uint8_t slot, unsigned long now) {
+    ErrorCodeStats& s = codeStats[slot];
+
+    // Lazy refill - no per-loop bookkeeping for quiet codes
+    if (now - s.lastRefillMs >= ERROR_TOKEN_REFILL_MS) {
+        unsigned long refills = (now - s.lastRefillMs) / ERROR_TOKEN_REFILL_MS;
+        uint8_t add = (refills > ERROR_TOKEN_CAPACITY) ? ERROR_TOKEN_CAPACITY : (uint8_t)refills;
+        s.tokens = (uint8_t)((s.tokens + add > ERROR_TOKEN_CAPACITY) ? ERROR_TOKEN_CAPACITY
+                                                                     : s.tokens + add);
+        s.lastRefillMs += refills * ERROR_TOKEN_REFILL_MS;
+    }
+
+    if (s.tokens == 0) return false;
+    s.tokens--;
+    return true;
+}
+
 void SystemErrorManager::setError(SystemErrorType errorType, const char* description) {
     bool wasFirstError = (activeErrors == 0);
-    
+    unsigned long now = millis();
+
+    // O(1) dedup slot: error codes are single bits
+    uint8_t slot = (uint8_t)__builtin_ctz((uint8_t)errorType) & (ERROR_CODE_SLOTS - 1);
+    ErrorCodeStats& stats = codeStats[slot];
+    if (stats.occurrences == 0) {
+        stats.firstMs = now;
+        stats.tokens = ERROR_TOKEN_CAPACITY;
+        stats.lastRefillMs = now;
+    }
+    stats.occurrences++;
+    stats.lastMs = now;
+
+    bool isRepeat = (activeErrors & errorType) != 0;
+
     // Set the error bit
     activeErrors |= errorType;
-    
+
     // Record when first error occurred
     if (wasFirstError) {
-        errorStartTime = millis();
+        errorStartTime = now;
     }
-    
+
+    // Repeats of an already-active error past the token budget become a
+    // bare counter increment - no formatting, no log, no telemetry. The
+    // periodic summary in update() reports what was swallowed.
+    if (isRepeat && !takeToken(slot, now)) {
+        stats.suppressedSinceReport++;
+        return;
+    }
+
     // Generate description if not provided
     const char* errorDesc = description ? description : getErrorDescription(errorType);
-    
+
     // Log with appropriate priority
-    if (errorType == ERROR_SEQUENCE_TIMEOUT || 
-        errorType == ERROR_EEPROM_CRC || 
-        errorType == ERROR_MEMORY_LOW || 
+    if (errorType == ERROR_SEQUENCE_TIMEOUT ||
+        errorType == ERROR_EEPROM_CRC ||
+        errorType == ERROR_MEMORY_LOW ||
         errorType == ERROR_HARDWARE_FAULT) {
         LOG_CRITICAL("SystemErrorManager: ERROR 0x%02X - %s", errorType, errorDesc);
     } else {
         LOG_ERROR("SystemErrorManager: ERROR 0x%02X - %s", errorType, errorDesc);
     }
-    
+
     // Also log to debug for backward compatibility
     debugPrintf("SystemErrorManager: ERROR 0x%02X - %s\n", errorType, errorDesc);
-    
+
     // Send telemetry for system error
     Telemetry::ErrorSeverity severity = getSeverityFromErrorType(errorType);
     telemetryManager.sendSystemError(errorType, errorDesc, severity, false, true);
-    
+
     // Publish to MQTT
     publishError(errorType, errorDesc);
-    
+
     // Update LED immediately
     updateLED();
+    statusCache.markDirty(STATUS_SECTION_ERRORS);
 }
 
 void SystemErrorManager::clearError(SystemErrorType errorType) {
@@ -79,9 +120,10 @@ void SystemErrorManager::clearError(SystemErrorType errorType) {
         if (activeErrors == 0) {
             errorStartTime = 0;
         }
-        
+
         // Update LED immediately
         updateLED();
+        statusCache.markDirty(STATUS_SECTION_ERRORS);
     }
 }
 
@@ -90,9 +132,10 @@ void SystemErrorManager::acknowledgeError(SystemErrorType errorType) {
         acknowledgedErrors |= errorType;
         
         debugPrintf("SystemErrorManager: Acknowledged error 0x%02X\n", errorType);
-        
+
         // Update LED (may change pattern)
         updateLED();
+        statusCache.markDirty(STATUS_SECTION_ERRORS);
     }
 }
 
@@ -103,11 +146,40 @@ void SystemErrorManager::clearAllErrors() {
         acknowledgedErrors = 0;
         errorStartTime = 0;
         updateLED();
+        statusCache.markDirty(STATUS_SECTION_ERRORS);
     }
 }
 
 void SystemErrorManager::update() {
     updateLED();
+
+    // Periodic roll-up of reports the token buckets swallowed
+    unsigned long now = millis();
+    if (now - lastSummaryTime >= ERROR_SUMMARY_INTERVAL_MS) {
+        publishSuppressedSummary(now);
+        lastSummaryTime = now;
+    }
+}
+
+void SystemErrorManager::publishSuppressedSummary(unsigned long now) {
+    for (uint8_t slot = 0; slot < ERROR_CODE_SLOTS; slot++) {
+        ErrorCodeStats& s = codeStats[slot];
+        if (s.suppressedSinceReport == 0) continue;
+
+        SystemErrorType errorType = (SystemErrorType)(1 << slot);
+        char desc[48];
+        snprintf(desc, sizeof(desc), "%s (x%lu suppressed)",
+                 getErrorDescription(errorType), (unsigned long)s.suppressedSinceReport);
+
+        LOG_WARN("SystemErrorManager: ERROR 0x%02X repeated %lu times in last %lus",
+                 errorType, (unsigned long)s.suppressedSinceReport,
+                 ERROR_SUMMARY_INTERVAL_MS / 1000);
+        telemetryManager.sendSystemError(errorType, desc,
+                                         getSeverityFromErrorType(errorType),
+                                         (acknowledgedErrors & errorType) != 0,
+                                         (activeErrors & errorType) != 0);
+        s.suppressedSinceReport = 0;
+    }
 }
 
 void SystemErrorManager::updateLED() {
@@ -286,6 +358,33 @@ void SystemErrorManager::listActiveErrors(char* buffer, size_t bufferSize) {
     buffer[pos] = '\0';
 }
 
+void SystemErrorManager::getErrorStatsString(char* buffer, size_t bufferSize) {
+    // One entry per code ever seen: count, age of first/last report,
+    // and whether the code is currently active/suppressed
+    int len = 0;
+    unsigned long now = millis();
+    bool any = false;
+
+    for (uint8_t slot = 0; slot < ERROR_CODE_SLOTS && (size_t)len < bufferSize; slot++) {
+        const ErrorCodeStats& s = codeStats[slot];
+        if (s.occurrences == 0) continue;
+
+        SystemErrorType errorType = (SystemErrorType)(1 << slot);
+        len += snprintf(buffer + len, bufferSize - len,
+            "%s0x%02X n=%lu first=%lus last=%lus%s%s",
+            any ? "; " : "",
+            errorType, (unsigned long)s.occurrences,
+            (now - s.firstMs) / 1000, (now - s.lastMs) / 1000,
+            (activeErrors & errorType) ? " ACTIVE" : "",
+            s.suppressedSinceReport ? " THROTTLED" : "");
+        any = true;
+    }
+
+    if (!any) {
+        snprintf(buffer, bufferSize, "no errors recorded");
+    }
+}
+
 int SystemErrorManager::getActiveErrorCount() const {
     int count = 0;
     uint8_t errors = activeErrors;
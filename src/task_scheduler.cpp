@@ -0,0 +1,79 @@
+#include "task_scheduler.h"
+#include "logger.h"
+
+TaskScheduler::TaskScheduler() : taskCount(0) {
+}
+
+bool TaskScheduler::addTask(const char* name, void (*run)(), unsigned long periodMs) {
+    if (taskCount >= MAX_TASKS || !run) {
+        LOG_ERROR("TaskScheduler: cannot register task '%s'", name ? name : "?");
+        return false;
+    }
+
+    tasks[taskCount].name = name;
+    tasks[taskCount].run = run;
+    tasks[taskCount].periodMs = periodMs;
+    tasks[taskCount].lastRunMs = millis();
+    tasks[taskCount].runCount = 0;
+    taskCount++;
+    return true;
+}
+
+void TaskScheduler::runOnce() {
+    unsigned long now = millis();
+    bool ranAny = false;
+
+    for (uint8_t i = 0; i < taskCount; i++) {
+        ScheduledTask& task = tasks[i];
+        if (task.periodMs == 0 || (now - task.lastRunMs) >= task.periodMs) {
+            task.lastRunMs = now;
+            task.runCount++;
+            task.run();
+            ranAny = true;
+        }
+    }
+
+    // Idle only when nothing was due this pass (never happens while any
+    // every-pass task is registered - intentional for the safety paths)
+    if (!ranAny) {
+        unsigned long wait = msUntilNextDue();
+        if (wait > MAX_IDLE_SLEEP_MS) wait = MAX_IDLE_SLEEP_MS;
+        if (wait > 0) delay(wait);
+    }
+}
+
+unsigned long TaskScheduler::msUntilNextDue() const {
+    unsigned long now = millis();
+    unsigned long soonest = (unsigned long)-1;
+
+    for (uint8_t i = 0; i < taskCount; i++) {
+        const ScheduledTask& task = tasks[i];
+        if (task.periodMs == 0) return 0;
+        unsigned long elapsed = now - task.lastRunMs;
+        if (elapsed >= task.periodMs) return 0;
+        unsigned long remaining = task.periodMs - elapsed;
+        if (remaining < soonest) soonest = remaining;
+    }
+    return (taskCount > 0) ? soonest : 0;
+}
+
+bool TaskScheduler::setTaskPeriod(const char* name, unsigned long periodMs) {
+    for (uint8_t i = 0; i < taskCount; i++) {
+        if (strcmp(tasks[i].name, name) == 0) {
+            tasks[i].periodMs = periodMs;
+            return true;
+        }
+    }
+    return false;
+}
+
+void TaskScheduler::getStatusString(char* buffer, size_t bufferSize) {
+    size_t offset = 0;
+    for (uint8_t i = 0; i < taskCount && offset < bufferSize - 1; i++) {
+        offset += snprintf(buffer + offset, bufferSize - offset, "%s%s=%lums(%lu)",
+            (i > 0) ? " " : "",
+            tasks[i].name,
+            tasks[i].periodMs,
+            (unsigned long)tasks[i].runCount);
+    }
+}
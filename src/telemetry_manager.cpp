@@ -6,44 +6,214 @@
  */
 
 #include "telemetry_manager.h"
+#include "memory_monitor.h"
+#include "safety_system.h"
 #include "constants.h"
 
-TelemetryManager::TelemetryManager() 
+TelemetryManager::TelemetryManager()
     : telemetrySerial(nullptr)
+    , usingHardwareUart(false)
     , sequenceId(0)
     , lastHeartbeat(0)
     , messagesSent(0)
     , bytesTransmitted(0)
+    , txOverflowCount(0)
+    , framesSent(0)
+    , batchLength(0)
+    , lastBatchFlush(0)
+    , txRingHead(0)
+    , txRingTail(0)
+    , txQueueHead(0)
+    , txQueueCount(0)
+    , txQueuePeakDepth(0)
+    , enqueuedCount(0)
+    , droppedBulkCount(0)
+    , droppedCriticalCount(0)
+    , lastLinkStats(0)
 {
 }
 
 void TelemetryManager::begin(uint8_t rxPin, uint8_t txPin, unsigned long baud) {
     // Create SoftwareSerial instance
-    telemetrySerial = new SoftwareSerial(rxPin, txPin);
-    telemetrySerial->begin(baud);
-    
+    SoftwareSerial* sws = new SoftwareSerial(rxPin, txPin);
+    sws->begin(baud);
+    telemetrySerial = sws;
+    usingHardwareUart = false;
+
     // Don't send startup message yet - system not fully initialized
     // sendSystemStatus() will be called later from main loop
-    
+
     lastHeartbeat = millis();
 }
 
 void TelemetryManager::begin(SoftwareSerial* existingSerial) {
     // Use existing SoftwareSerial instance (avoid conflicts)
     telemetrySerial = existingSerial;
-    
+    usingHardwareUart = false;
+
     // Don't send startup message yet - system not fully initialized
     // sendSystemStatus() will be called later from main loop
-    
+
+    lastHeartbeat = millis();
+}
+
+void TelemetryManager::begin(HardwareSerial* hwSerial, unsigned long baud) {
+    // Hardware UART backend: the core's SCI driver handles TX from its own
+    // interrupt-driven buffer, so drainTxRing() never bit-bangs
+    hwSerial->begin(baud);
+    telemetrySerial = hwSerial;
+    usingHardwareUart = true;
+
     lastHeartbeat = millis();
 }
 
 void TelemetryManager::update() {
-    // Send periodic heartbeat (every 5 seconds)
-    unsigned long now = millis();
-    if (now - lastHeartbeat >= 5000) {
-        sendSystemStatus();
-        lastHeartbeat = now;
+    // Move queued messages into the batch while the ring has room
+    drainQueueToBatch();
+
+    // Flush a partially filled batch once the flush timer expires so
+    // low-rate messages don't sit in the buffer indefinitely
+    if (batchLength > 0 && (millis() - lastBatchFlush) >= BATCH_FLUSH_INTERVAL_MS) {
+        flushBatch();
+    }
+
+    // Periodic queue accounting for the receiver's loss bookkeeping
+    if (millis() - lastLinkStats >= LINK_STATS_INTERVAL_MS) {
+        lastLinkStats = millis();
+        sendLinkStats();
+    }
+
+    // Push buffered frames out without blocking the loop
+    // (heartbeat cadence is owned by publishTelemetry() in main.cpp)
+    drainTxRing();
+}
+
+void TelemetryManager::flushBlocking(unsigned long maxWaitMs) {
+    if (!telemetrySerial) return;
+
+    drainQueueToBatch();
+    flushBatch();
+    unsigned long start = millis();
+    while ((txQueueCount > 0 || batchLength > 0 || txRingTail != txRingHead) &&
+           (millis() - start) < maxWaitMs) {
+        drainTxRing();
+        drainQueueToBatch();
+        flushBatch();
+    }
+}
+
+// ============================================================================
+// Frame Encoding (COBS + CRC16)
+// ============================================================================
+
+// CRC16-CCITT (poly 0x1021, init 0xFFFF) - computed over the raw batch
+// before COBS encoding, appended little-endian
+uint16_t TelemetryManager::crc16(const uint8_t* data, size_t len) {
+    uint16_t crc = 0xFFFF;
+    for (size_t i = 0; i < len; i++) {
+        crc ^= (uint16_t)data[i] << 8;
+        for (uint8_t bit = 0; bit < 8; bit++) {
+            crc = (crc & 0x8000) ? (crc << 1) ^ 0x1021 : (crc << 1);
+        }
+    }
+    return crc;
+}
+
+// COBS encoding: removes all 0x00 bytes from the frame so the delimiter is
+// unambiguous. Worst-case expansion is one byte per 254, plus the leading
+// code byte. Returns the encoded length (delimiter not included).
+size_t TelemetryManager::cobsEncode(const uint8_t* src, size_t len, uint8_t* dst) {
+    size_t outPos = 1;   // Position after the pending code byte
+    size_t codePos = 0;  // Where the current code byte will be written
+    uint8_t code = 1;
+
+    for (size_t i = 0; i < len; i++) {
+        if (src[i] == 0) {
+            dst[codePos] = code;
+            codePos = outPos++;
+            code = 1;
+        } else {
+            dst[outPos++] = src[i];
+            if (++code == 0xFF) {
+                dst[codePos] = code;
+                codePos = outPos++;
+                code = 1;
+            }
+        }
+    }
+    dst[codePos] = code;
+    return outPos;
+}
+
+void TelemetryManager::flushBatch() {
+    if (batchLength == 0) return;
+
+    // Worst-case encoded size check first: on a full ring the batch is
+    // kept and traffic backs up into the priority queue, whose drop
+    // policy is class-aware - whole frames are never dropped here
+    size_t worstCase = batchLength + 2 + (batchLength + 2) / 254 + 2;
+    if (txRingFree() < worstCase) {
+        if (txOverflowCount != 0xFFFFFFFF) txOverflowCount++;
+        return;
+    }
+
+    // Append CRC16 over the raw batch, then COBS-encode the whole frame
+    uint16_t crc = crc16(batchBuffer, batchLength);
+    uint8_t raw[BATCH_BUFFER_SIZE + 2];
+    memcpy(raw, batchBuffer, batchLength);
+    raw[batchLength] = (uint8_t)(crc & 0xFF);
+    raw[batchLength + 1] = (uint8_t)(crc >> 8);
+
+    uint8_t encoded[BATCH_BUFFER_SIZE + 2 + (BATCH_BUFFER_SIZE + 2) / 254 + 2];
+    size_t encodedLen = cobsEncode(raw, batchLength + 2, encoded);
+    encoded[encodedLen++] = FRAME_DELIMITER;
+
+    txRingPush(encoded, encodedLen);
+    framesSent++;
+    bytesTransmitted += encodedLen;
+    batchLength = 0;
+    lastBatchFlush = millis();
+
+    // Opportunistically start transmission so frames go out promptly
+    drainTxRing();
+}
+
+// ============================================================================
+// TX Ring Buffer
+// ============================================================================
+
+size_t TelemetryManager::txRingFree() const {
+    if (txRingHead >= txRingTail) {
+        return TX_RING_SIZE - 1 - (txRingHead - txRingTail);
+    }
+    return txRingTail - txRingHead - 1;
+}
+
+void TelemetryManager::txRingPush(const uint8_t* data, size_t len) {
+    for (size_t i = 0; i < len; i++) {
+        txRing[txRingHead] = data[i];
+        txRingHead = (txRingHead + 1) % TX_RING_SIZE;
+    }
+}
+
+void TelemetryManager::drainTxRing() {
+    if (!telemetrySerial || txRingTail == txRingHead) return;
+
+    // Hardware UART reports real TX buffer space; SoftwareSerial has no TX
+    // buffer, so cap the chunk to bound the bit-banged blocking time
+    size_t writable;
+    if (usingHardwareUart) {
+        int space = telemetrySerial->availableForWrite();
+        if (space <= 0) return;
+        writable = (size_t)space;
+    } else {
+        writable = 16;
+    }
+
+    while (writable > 0 && txRingTail != txRingHead) {
+        telemetrySerial->write(txRing[txRingTail]);
+        txRingTail = (txRingTail + 1) % TX_RING_SIZE;
+        writable--;
     }
 }
 
@@ -131,7 +301,7 @@ void TelemetryManager::sendSystemError(uint8_t errorCode, const char* descriptio
     sendMessage(&msg, sizeof(msg));
 }
 
-void TelemetryManager::sendSafetyEvent(uint8_t eventType, bool isActive) {
+void TelemetryManager::sendSafetyEvent(uint8_t eventType, bool isActive, uint16_t tripLatencyUs) {
     if (!telemetrySerial) return;
     
     Telemetry::SafetyEvent msg;
@@ -139,7 +309,7 @@ void TelemetryManager::sendSafetyEvent(uint8_t eventType, bool isActive) {
     
     msg.event_type = eventType;
     msg.flags = isActive ? 1 : 0;
-    msg.reserved = 0;
+    msg.trip_latency_us = tripLatencyUs;
     
     sendMessage(&msg, sizeof(msg));
 }
@@ -152,16 +322,53 @@ void TelemetryManager::sendSystemStatus() {
     
     msg.uptime_ms = millis();
     msg.loop_frequency_hz = 0; // TODO: Calculate from main loop timing
-    msg.free_memory_bytes = 0; // TODO: Get free memory
+
+    // Memory stats from the paint-and-scan monitor (capped to the field width)
+    msg.free_memory_bytes = 0;
+    msg.stack_headroom_bytes = 0;
+    if (memoryMonitor) {
+        uint32_t freeBytes = memoryMonitor->getFreeLowWaterBytes();
+        uint32_t headroom = memoryMonitor->getStackHeadroomBytes();
+        msg.free_memory_bytes = (freeBytes > 0xFFFF) ? 0xFFFF : (uint16_t)freeBytes;
+        msg.stack_headroom_bytes = (headroom > 0xFFFF) ? 0xFFFF : (uint16_t)headroom;
+    }
+
+    // E-stop fast path reaction latency (microseconds, capped to field width)
+    msg.estop_latency_last_us = 0;
+    msg.estop_latency_max_us = 0;
+    if (safetySystem) {
+        uint32_t lastUs = safetySystem->getEStopLatencyLastUs();
+        uint32_t maxUs = safetySystem->getEStopLatencyMaxUs();
+        msg.estop_latency_last_us = (lastUs > 0xFFFF) ? 0xFFFF : (uint16_t)lastUs;
+        msg.estop_latency_max_us = (maxUs > 0xFFFF) ? 0xFFFF : (uint16_t)maxUs;
+    }
+
+    // Boot fast path: reset to safety-armed, ms resolution
+    uint32_t safeMs = timeToSafeStateUs / 1000;
+    msg.time_to_safe_ms = (safeMs > 0xFFFF) ? 0xFFFF : (uint16_t)safeMs;
+
     msg.active_error_count = 0; // TODO: Get from error manager
-    
+
     // Pack flags: safety_active, estop_active, sequence_state, mill_lamp_pattern
     msg.flags = 0; // TODO: Get actual system state
-    msg.reserved = 0;
     
     sendMessage(&msg, sizeof(msg));
 }
 
+void TelemetryManager::sendFlightRecord(uint32_t timestampUs, uint8_t eventType, uint8_t detail, uint16_t value) {
+    if (!telemetrySerial) return;
+
+    Telemetry::FlightRecordMsg msg;
+    setHeader(msg.header, Telemetry::MSG_FLIGHT_RECORD);
+
+    msg.timestamp_us = timestampUs;
+    msg.event_type = eventType;
+    msg.detail = detail;
+    msg.value = value;
+
+    sendMessage(&msg, sizeof(msg));
+}
+
 void TelemetryManager::sendSequenceEvent(uint8_t eventType, uint8_t stepNumber, uint16_t elapsedTime) {
     if (!telemetrySerial) return;
     
@@ -175,6 +382,60 @@ void TelemetryManager::sendSequenceEvent(uint8_t eventType, uint8_t stepNumber,
     sendMessage(&msg, sizeof(msg));
 }
 
+void TelemetryManager::sendTimingStats(uint8_t subsystemId, uint32_t p50Us, uint32_t p95Us, uint32_t p99Us, uint32_t maxUs, uint32_t callCount) {
+    if (!telemetrySerial) return;
+
+    Telemetry::TimingStats msg;
+    setHeader(msg.header, Telemetry::MSG_TIMING_STATS);
+
+    msg.subsystem_id = subsystemId;
+    msg.reserved = 0;
+    msg.p50_us = p50Us;
+    msg.p95_us = p95Us;
+    msg.p99_us = p99Us;
+    msg.max_us = maxUs;
+    msg.call_count = callCount;
+
+    sendMessage(&msg, sizeof(msg));
+}
+
+void TelemetryManager::sendLoopStats(const uint32_t* histogram, uint32_t loopCount, uint32_t worstUs,
+                                     uint32_t outlierCount, uint32_t lastOutlierUs, uint8_t lastOutlierSubsystem) {
+    if (!telemetrySerial) return;
+
+    Telemetry::LoopStatsMsg msg;
+    setHeader(msg.header, Telemetry::MSG_LOOP_STATS);
+
+    msg.loop_count = loopCount;
+    msg.worst_us = worstUs;
+    msg.outlier_count = outlierCount;
+    msg.last_outlier_us = lastOutlierUs;
+    msg.last_outlier_subsystem = lastOutlierSubsystem;
+    msg.reserved = 0;
+    for (uint8_t b = 0; b < 26; b++) {
+        msg.bucket_counts[b] = (histogram[b] > 0xFFFF) ? 0xFFFF : (uint16_t)histogram[b];
+    }
+
+    sendMessage(&msg, sizeof(msg));
+}
+
+void TelemetryManager::sendCycleStats(uint32_t completedCount, uint32_t abortedCount,
+                                      const uint16_t* stage1Stats, const uint16_t* stage2Stats) {
+    if (!telemetrySerial) return;
+
+    Telemetry::CycleStatsMsg msg;
+    setHeader(msg.header, Telemetry::MSG_CYCLE_STATS);
+
+    msg.completed_count = completedCount;
+    msg.aborted_count = abortedCount;
+    for (uint8_t i = 0; i < 6; i++) {
+        msg.stage_stats[0][i] = stage1Stats[i];
+        msg.stage_stats[1][i] = stage2Stats[i];
+    }
+
+    sendMessage(&msg, sizeof(msg));
+}
+
 // Private helper methods
 
 void TelemetryManager::setHeader(Telemetry::MessageHeader& header, Telemetry::MessageType msgType) {
@@ -183,20 +444,109 @@ void TelemetryManager::setHeader(Telemetry::MessageHeader& header, Telemetry::Me
     header.timestamp_ms = getTimestamp();
 }
 
+bool TelemetryManager::isCriticalType(uint8_t msgType) {
+    // Never-drop classes: safety, errors, actuator and sequence events,
+    // and the link accounting itself
+    switch (msgType) {
+        case Telemetry::MSG_SYSTEM_ERROR:
+        case Telemetry::MSG_SAFETY_EVENT:
+        case Telemetry::MSG_RELAY_EVENT:
+        case Telemetry::MSG_SEQUENCE_EVENT:
+        case Telemetry::MSG_LINK_STATS:
+            return true;
+        default:
+            return false;
+    }
+}
+
 void TelemetryManager::sendMessage(const void* message, size_t size) {
-    if (!telemetrySerial) return;
-    
-    // Send size byte first (for message framing)
-    telemetrySerial->write((uint8_t)size);
-    
-    // Send message data
-    const uint8_t* data = (const uint8_t*)message;
-    for (size_t i = 0; i < size; i++) {
-        telemetrySerial->write(data[i]);
+    if (!telemetrySerial || size > TX_QUEUE_MSG_MAX) return;
+
+    // Stage into the bounded priority queue; the header's msg_type byte
+    // is first, so classification needs no extra parameter
+    enqueuedCount++;
+    bool critical = isCriticalType(((const uint8_t*)message)[0]);
+
+    if (txQueueCount == TX_QUEUE_SLOTS) {
+        // Full: drop the oldest bulk message in place, then reclaim any
+        // leading tombstones so the tail slot frees up
+        for (uint8_t i = 0; i < txQueueCount; i++) {
+            uint8_t idx = (uint8_t)((txQueueHead + i) % TX_QUEUE_SLOTS);
+            if (txQueue[idx].len != 0 && !txQueue[idx].critical) {
+                txQueue[idx].len = 0;
+                droppedBulkCount++;
+                break;
+            }
+        }
+        while (txQueueCount > 0 && txQueue[txQueueHead].len == 0) {
+            txQueueHead = (uint8_t)((txQueueHead + 1) % TX_QUEUE_SLOTS);
+            txQueueCount--;
+        }
+        if (txQueueCount == TX_QUEUE_SLOTS) {
+            // No bulk slot reclaimable at the head - the incoming message
+            // is the one dropped
+            if (critical) droppedCriticalCount++; else droppedBulkCount++;
+            return;
+        }
     }
-    
-    messagesSent++;
-    bytesTransmitted += size + 1; // +1 for size byte
+
+    uint8_t idx = (uint8_t)((txQueueHead + txQueueCount) % TX_QUEUE_SLOTS);
+    txQueue[idx].len = (uint8_t)size;
+    txQueue[idx].critical = critical ? 1 : 0;
+    memcpy(txQueue[idx].data, message, size);
+    txQueueCount++;
+    if (txQueueCount > txQueuePeakDepth) txQueuePeakDepth = txQueueCount;
+
+    // Opportunistic drain keeps enqueue-to-wire latency at one call on a
+    // healthy link; under backpressure this returns immediately
+    drainQueueToBatch();
+}
+
+void TelemetryManager::drainQueueToBatch() {
+    while (txQueueCount > 0) {
+        QueueSlot& slot = txQueue[txQueueHead];
+        if (slot.len == 0) {
+            // Tombstoned by the drop policy
+            txQueueHead = (uint8_t)((txQueueHead + 1) % TX_QUEUE_SLOTS);
+            txQueueCount--;
+            continue;
+        }
+
+        // Accumulate [size][payload] records into the batch buffer;
+        // flushBatch() wraps the batch in one CRC16 + COBS frame
+        if (batchLength + slot.len + 1 > BATCH_BUFFER_SIZE) {
+            flushBatch();
+            if (batchLength != 0) return;  // TX ring full - stay queued
+        }
+        if (batchLength == 0) {
+            lastBatchFlush = millis(); // Start the flush timer for this batch
+        }
+
+        batchBuffer[batchLength++] = slot.len;
+        memcpy(batchBuffer + batchLength, slot.data, slot.len);
+        batchLength += slot.len;
+        messagesSent++;
+
+        txQueueHead = (uint8_t)((txQueueHead + 1) % TX_QUEUE_SLOTS);
+        txQueueCount--;
+    }
+}
+
+void TelemetryManager::sendLinkStats() {
+    if (!telemetrySerial) return;
+
+    Telemetry::LinkStatsMsg msg;
+    setHeader(msg.header, Telemetry::MSG_LINK_STATS);
+
+    msg.enqueued = enqueuedCount;
+    msg.sent = messagesSent;
+    msg.dropped_bulk = droppedBulkCount;
+    msg.dropped_critical = droppedCriticalCount;
+    msg.backpressure = (txOverflowCount > 0xFFFF) ? 0xFFFF : (uint16_t)txOverflowCount;
+    msg.peak_depth = txQueuePeakDepth;
+    msg.depth = txQueueCount;
+
+    sendMessage(&msg, sizeof(msg));
 }
 
 Telemetry::InputType TelemetryManager::getInputType(uint8_t pin) {
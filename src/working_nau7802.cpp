@@ -0,0 +1,422 @@
+#include "working_nau7802.h"
+#include "logger.h"
+#include <EEPROM.h>
+
+extern void debugPrintf(const char* fmt, ...);
+
+// The scale lives on Wire1 (the R4 WiFi's Qwiic connector). The primary
+// Wire bus muxes onto A4/A5, and this board dedicates those pins to the
+// telemetry UART - bringing both peripherals up would fight over the
+// same two pins and whichever initializes last wins.
+#ifdef ARDUINO_ARCH_RENESAS_UNO
+static TwoWire& nauWire = Wire1;
+#else
+static TwoWire& nauWire = Wire;  // env:native shim has a single bus
+#endif
+
+NAU7802Sensor::NAU7802Sensor() {
+    initializeDefaults();
+}
+
+void NAU7802Sensor::initializeDefaults() {
+    lastError = NAU7802_OK;
+    acqState = NAU_ACQ_OFFLINE;
+    lastConnectAttempt = 0;
+    calibrationFactor = 1.0f;
+    zeroOffset = 0;
+    isCalibrated = false;
+    lastRawReading = 0;
+    lastWeight = 0.0f;
+    lastFilteredWeight = 0.0f;
+    filteringEnabled = true;
+    filterSamples = 10;
+    filterIndex = 0;
+    filterBufferFull = false;
+    memset(filterBuffer, 0, sizeof(filterBuffer));
+    currentGain = NAU7802_GAIN_128;
+    currentSampleRate = NAU7802_SPS_80;
+    totalReadings = 0;
+    minReading = 0.0f;
+    maxReading = 0.0f;
+}
+
+// Register access - each helper is one short transaction at 400 kHz
+
+bool NAU7802Sensor::writeRegister(uint8_t reg, uint8_t value) {
+    nauWire.beginTransmission(NAU7802_I2C_ADDR);
+    nauWire.write(reg);
+    nauWire.write(value);
+    return nauWire.endTransmission() == 0;
+}
+
+bool NAU7802Sensor::readRegister(uint8_t reg, uint8_t& value) {
+    nauWire.beginTransmission(NAU7802_I2C_ADDR);
+    nauWire.write(reg);
+    if (nauWire.endTransmission(false) != 0) return false;
+    if (nauWire.requestFrom((uint8_t)NAU7802_I2C_ADDR, (uint8_t)1) != 1) return false;
+    value = (uint8_t)nauWire.read();
+    return true;
+}
+
+bool NAU7802Sensor::readConversion(long& value) {
+    nauWire.beginTransmission(NAU7802_I2C_ADDR);
+    nauWire.write(NAU7802_REG_ADCO_B2);
+    if (nauWire.endTransmission(false) != 0) return false;
+    if (nauWire.requestFrom((uint8_t)NAU7802_I2C_ADDR, (uint8_t)3) != 3) return false;
+
+    uint32_t raw = ((uint32_t)nauWire.read() << 16) |
+                   ((uint32_t)nauWire.read() << 8) |
+                   (uint32_t)nauWire.read();
+    // Sign-extend the 24-bit two's complement result
+    if (raw & 0x800000) raw |= 0xFF000000;
+    value = (long)(int32_t)raw;
+    return true;
+}
+
+bool NAU7802Sensor::setRegisterBits(uint8_t reg, uint8_t bits, bool set) {
+    uint8_t value;
+    if (!readRegister(reg, value)) return false;
+    if (set) value |= bits; else value &= ~bits;
+    return writeRegister(reg, value);
+}
+
+// Device bring-up
+
+bool NAU7802Sensor::initializeDevice() {
+    if (!isConnected()) return false;
+
+    // Reset all registers, then power up digital + analog
+    writeRegister(NAU7802_REG_PU_CTRL, NAU7802_PU_CTRL_RR);
+    writeRegister(NAU7802_REG_PU_CTRL, NAU7802_PU_CTRL_PUD | NAU7802_PU_CTRL_PUA);
+
+    // Power-up ready is typically <1 ms; bounded poll (init path only)
+    uint8_t puCtrl = 0;
+    for (uint8_t i = 0; i < 20; i++) {
+        if (readRegister(NAU7802_REG_PU_CTRL, puCtrl) && (puCtrl & NAU7802_PU_CTRL_PUR)) break;
+        delayMicroseconds(100);
+    }
+    if (!(puCtrl & NAU7802_PU_CTRL_PUR)) return false;
+
+    // LDO 3.3V (VLDO=100b) + gain in CTRL1, sample rate in CTRL2
+    writeRegister(NAU7802_REG_CTRL1, (uint8_t)(0x20 | (currentGain & 0x07)));
+    writeRegister(NAU7802_REG_CTRL2, (uint8_t)((currentSampleRate & 0x07) << 4));
+
+    // Datasheet-recommended analog setup: CLK_CHP off, PGA output cap on
+    writeRegister(NAU7802_REG_ADC, 0x30);
+    setRegisterBits(NAU7802_REG_POWER, 0x80, true);
+
+    // Use the internal LDO for AVDD and start continuous conversions
+    setRegisterBits(NAU7802_REG_PU_CTRL, NAU7802_PU_CTRL_AVDDS | NAU7802_PU_CTRL_CS, true);
+
+    // Kick AFE calibration; the update machine polls completion
+    setRegisterBits(NAU7802_REG_CTRL2, NAU7802_CTRL2_CALS, true);
+    acqState = NAU_ACQ_CALIBRATING;
+    return true;
+}
+
+NAU7802Status NAU7802Sensor::begin() {
+    nauWire.begin();
+    nauWire.setClock(400000);  // Fast-mode: 3-byte conversion read ~100 us
+
+    if (!initializeDevice()) {
+        logError(NAU7802_NOT_FOUND, "begin");
+        return NAU7802_NOT_FOUND;
+    }
+
+    loadCalibration();
+    LOG_INFO("NAU7802: initialized (400 kHz, gain=%u, rate=%u), calibrating AFE",
+             currentGain, currentSampleRate);
+    return NAU7802_OK;
+}
+
+bool NAU7802Sensor::isConnected() {
+    nauWire.beginTransmission(NAU7802_I2C_ADDR);
+    return nauWire.endTransmission() == 0;
+}
+
+void NAU7802Sensor::reset() {
+    writeRegister(NAU7802_REG_PU_CTRL, NAU7802_PU_CTRL_RR);
+    acqState = NAU_ACQ_OFFLINE;
+    lastConnectAttempt = millis();
+    resetStatistics();
+}
+
+// Acquisition state machine - one short transaction per pass, so weight
+// acquisition never adds measurable latency to the safety path
+
+void NAU7802Sensor::updateReading() {
+    unsigned long now = millis();
+
+    switch (acqState) {
+        case NAU_ACQ_OFFLINE:
+            // Periodic reconnect attempt (device absent or reset)
+            if (now - lastConnectAttempt >= 5000) {
+                lastConnectAttempt = now;
+                if (initializeDevice()) {
+                    LOG_INFO("NAU7802: device reconnected, calibrating AFE");
+                }
+            }
+            break;
+
+        case NAU_ACQ_CALIBRATING: {
+            uint8_t ctrl2;
+            if (!readRegister(NAU7802_REG_CTRL2, ctrl2)) {
+                logError(NAU7802_READ_ERROR, "updateReading");
+                acqState = NAU_ACQ_OFFLINE;
+                lastConnectAttempt = now;
+                break;
+            }
+            if (!(ctrl2 & NAU7802_CTRL2_CALS)) {
+                if (ctrl2 & NAU7802_CTRL2_CAL_ERR) {
+                    logError(NAU7802_CALIBRATION_FAILED, "updateReading");
+                } else {
+                    LOG_INFO("NAU7802: AFE calibration complete");
+                }
+                acqState = NAU_ACQ_POLLING;
+            }
+            break;
+        }
+
+        case NAU_ACQ_POLLING: {
+            uint8_t puCtrl;
+            if (!readRegister(NAU7802_REG_PU_CTRL, puCtrl)) {
+                logError(NAU7802_READ_ERROR, "updateReading");
+                acqState = NAU_ACQ_OFFLINE;
+                lastConnectAttempt = now;
+                break;
+            }
+            if (!(puCtrl & NAU7802_PU_CTRL_CR)) break;  // No new conversion yet
+
+            long raw;
+            if (!readConversion(raw)) {
+                logError(NAU7802_READ_ERROR, "updateReading");
+                break;
+            }
+
+            lastRawReading = raw;
+            lastWeight = applyCalibration(raw);
+            updateFilter(lastWeight);
+
+            if (totalReadings == 0) {
+                minReading = maxReading = lastWeight;
+            } else {
+                if (lastWeight < minReading) minReading = lastWeight;
+                if (lastWeight > maxReading) maxReading = lastWeight;
+            }
+            totalReadings++;
+            break;
+        }
+    }
+}
+
+// Calibration
+
+NAU7802Status NAU7802Sensor::calibrateAFE() {
+    if (acqState == NAU_ACQ_OFFLINE) return NAU7802_NOT_FOUND;
+    if (!setRegisterBits(NAU7802_REG_CTRL2, NAU7802_CTRL2_CALS, true)) {
+        logError(NAU7802_READ_ERROR, "calibrateAFE");
+        return NAU7802_READ_ERROR;
+    }
+    acqState = NAU_ACQ_CALIBRATING;
+    return NAU7802_OK;
+}
+
+NAU7802Status NAU7802Sensor::calibrateZero() {
+    if (!isReady()) return NAU7802_NOT_READY;
+    zeroOffset = lastRawReading;
+    isCalibrated = true;
+    LOG_INFO("NAU7802: zero offset set to %ld", zeroOffset);
+    return NAU7802_OK;
+}
+
+NAU7802Status NAU7802Sensor::calibrateScale(float knownWeight) {
+    if (!isReady()) return NAU7802_NOT_READY;
+    if (knownWeight <= 0.0f) return NAU7802_CALIBRATION_FAILED;
+
+    long delta = lastRawReading - zeroOffset;
+    if (delta == 0) {
+        logError(NAU7802_CALIBRATION_FAILED, "calibrateScale");
+        return NAU7802_CALIBRATION_FAILED;
+    }
+    calibrationFactor = (float)delta / knownWeight;
+    isCalibrated = true;
+    LOG_INFO("NAU7802: calibration factor %.4f (known weight %.2f)",
+             calibrationFactor, knownWeight);
+    return NAU7802_OK;
+}
+
+void NAU7802Sensor::tareScale() {
+    if (isReady()) {
+        zeroOffset = lastRawReading;
+    }
+}
+
+float NAU7802Sensor::applyCalibration(long rawValue) {
+    if (calibrationFactor == 0.0f) return 0.0f;
+    return (float)(rawValue - zeroOffset) / calibrationFactor;
+}
+
+// Configuration
+
+void NAU7802Sensor::setGain(uint8_t gain) {
+    currentGain = gain & 0x07;
+    uint8_t ctrl1;
+    if (readRegister(NAU7802_REG_CTRL1, ctrl1)) {
+        writeRegister(NAU7802_REG_CTRL1, (uint8_t)((ctrl1 & 0xF8) | currentGain));
+    }
+}
+
+void NAU7802Sensor::setSampleRate(uint8_t rate) {
+    currentSampleRate = rate & 0x07;
+    uint8_t ctrl2;
+    if (readRegister(NAU7802_REG_CTRL2, ctrl2)) {
+        writeRegister(NAU7802_REG_CTRL2, (uint8_t)((ctrl2 & 0x8F) | (currentSampleRate << 4)));
+    }
+}
+
+// Filtering - conversions are batched into filterBuffer as they complete,
+// so getFilteredWeight() is just a cached read from loop context
+
+void NAU7802Sensor::enableFiltering(bool enable, uint8_t samples) {
+    filteringEnabled = enable;
+    if (samples < 1) samples = 1;
+    if (samples > NAU7802_FILTER_MAX) samples = NAU7802_FILTER_MAX;
+    filterSamples = samples;
+    filterIndex = 0;
+    filterBufferFull = false;
+}
+
+void NAU7802Sensor::updateFilter(float value) {
+    if (!filteringEnabled) {
+        lastFilteredWeight = value;
+        return;
+    }
+
+    filterBuffer[filterIndex] = value;
+    filterIndex = (uint8_t)((filterIndex + 1) % filterSamples);
+    if (filterIndex == 0) filterBufferFull = true;
+
+    uint8_t count = filterBufferFull ? filterSamples : filterIndex;
+    float sum = 0.0f;
+    for (uint8_t i = 0; i < count; i++) sum += filterBuffer[i];
+    lastFilteredWeight = sum / count;
+}
+
+float NAU7802Sensor::getAverageReading(uint8_t samples) {
+    // Average of the most recent buffered conversions - no blocking reads
+    uint8_t have = filterBufferFull ? filterSamples : filterIndex;
+    if (have == 0) return lastWeight;
+    if (samples > have) samples = have;
+
+    float sum = 0.0f;
+    for (uint8_t i = 0; i < samples; i++) {
+        uint8_t idx = (uint8_t)((filterIndex + filterSamples - 1 - i) % filterSamples);
+        sum += filterBuffer[idx];
+    }
+    return sum / samples;
+}
+
+void NAU7802Sensor::resetStatistics() {
+    totalReadings = 0;
+    minReading = 0.0f;
+    maxReading = 0.0f;
+    filterIndex = 0;
+    filterBufferFull = false;
+}
+
+// Status and diagnostics
+
+const char* NAU7802Sensor::getStatusString() const {
+    switch (lastError) {
+        case NAU7802_OK: return "OK";
+        case NAU7802_NOT_FOUND: return "NOT_FOUND";
+        case NAU7802_CALIBRATION_FAILED: return "CAL_FAILED";
+        case NAU7802_READ_ERROR: return "READ_ERROR";
+        case NAU7802_NOT_READY: return "NOT_READY";
+        default: return "UNKNOWN";
+    }
+}
+
+void NAU7802Sensor::getStatusString(char* buffer, size_t bufferSize) {
+    snprintf(buffer, bufferSize,
+        "weight=%.2f raw=%ld readings=%lu state=%d err=%s calibrated=%d",
+        lastFilteredWeight, lastRawReading, totalReadings,
+        (int)acqState, getStatusString(), isCalibrated ? 1 : 0);
+}
+
+// Power management
+
+void NAU7802Sensor::powerUp() {
+    setRegisterBits(NAU7802_REG_PU_CTRL,
+                    NAU7802_PU_CTRL_PUD | NAU7802_PU_CTRL_PUA | NAU7802_PU_CTRL_CS, true);
+}
+
+void NAU7802Sensor::powerDown() {
+    setRegisterBits(NAU7802_REG_PU_CTRL,
+                    NAU7802_PU_CTRL_PUD | NAU7802_PU_CTRL_PUA, false);
+}
+
+bool NAU7802Sensor::isPoweredUp() {
+    uint8_t puCtrl;
+    if (!readRegister(NAU7802_REG_PU_CTRL, puCtrl)) return false;
+    return (puCtrl & NAU7802_PU_CTRL_PUD) != 0;
+}
+
+// EEPROM calibration storage - magic + additive checksum, rejected and
+// defaulted on mismatch (same recovery model as ConfigManager)
+
+static uint32_t nau7802Checksum(const NAU7802CalibrationData& data) {
+    const uint8_t* bytes = (const uint8_t*)&data;
+    size_t len = sizeof(data) - sizeof(data.checksum);
+    uint32_t sum = 0;
+    for (size_t i = 0; i < len; i++) sum += bytes[i];
+    return sum;
+}
+
+bool NAU7802Sensor::saveCalibration() {
+    NAU7802CalibrationData data;
+    data.magic = NAU7802_CALIBRATION_MAGIC;
+    data.calibrationFactor = calibrationFactor;
+    data.zeroOffset = zeroOffset;
+    data.gain = currentGain;
+    data.sampleRate = currentSampleRate;
+    data.checksum = nau7802Checksum(data);
+
+    EEPROM.put(NAU7802_CALIBRATION_ADDR, data);
+    LOG_INFO("NAU7802: calibration saved");
+    return true;
+}
+
+bool NAU7802Sensor::loadCalibration() {
+    NAU7802CalibrationData data;
+    EEPROM.get(NAU7802_CALIBRATION_ADDR, data);
+
+    if (data.magic != NAU7802_CALIBRATION_MAGIC ||
+        data.checksum != nau7802Checksum(data)) {
+        debugPrintf("NAU7802: no stored calibration, using defaults\n");
+        return false;
+    }
+
+    calibrationFactor = data.calibrationFactor;
+    zeroOffset = data.zeroOffset;
+    currentGain = data.gain & 0x07;
+    currentSampleRate = data.sampleRate & 0x07;
+    isCalibrated = true;
+    LOG_INFO("NAU7802: calibration loaded (factor=%.4f, zero=%ld)",
+             calibrationFactor, zeroOffset);
+    return true;
+}
+
+void NAU7802Sensor::clearCalibration() {
+    NAU7802CalibrationData data;
+    memset(&data, 0xFF, sizeof(data));
+    EEPROM.put(NAU7802_CALIBRATION_ADDR, data);
+    calibrationFactor = 1.0f;
+    zeroOffset = 0;
+    isCalibrated = false;
+}
+
+void NAU7802Sensor::logError(NAU7802Status error, const char* function) {
+    lastError = error;
+    LOG_WARN("NAU7802: %s in %s", getStatusString(), function);
+}
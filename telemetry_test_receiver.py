@@ -36,6 +36,32 @@ class MessageType:
     SEQUENCE_EVENT = 0x06
     ERROR_EVENT = 0x07
 
+FRAME_DELIMITER = 0x00
+
+def cobs_decode(data):
+    """Decode a COBS-encoded frame (delimiter already stripped)"""
+    output = bytearray()
+    i = 0
+    while i < len(data):
+        code = data[i]
+        if code == 0 or i + code > len(data):
+            return None  # Malformed frame
+        output.extend(data[i + 1:i + code])
+        i += code
+        if code < 0xFF and i < len(data):
+            output.append(0)
+    return bytes(output)
+
+def crc16_ccitt(data):
+    """CRC16-CCITT (poly 0x1021, init 0xFFFF) - matches TelemetryManager"""
+    crc = 0xFFFF
+    for byte in data:
+        crc ^= byte << 8
+        for _ in range(8):
+            crc = ((crc << 1) ^ 0x1021) if (crc & 0x8000) else (crc << 1)
+            crc &= 0xFFFF
+    return crc
+
 class TelemetryReceiver:
     def __init__(self, port=None, baud=115200):
         self.port = port or self.auto_detect_arduino()
@@ -43,8 +69,12 @@ class TelemetryReceiver:
         self.ser = None
         self.messages_received = 0
         self.bytes_received = 0
+        self.frames_received = 0
+        self.crc_errors = 0
         self.last_sequence_id = None
-        
+        self.frame_buffer = bytearray()
+        self.pending_messages = []
+
     def auto_detect_arduino(self):
         """Auto-detect Arduino controller COM port"""
         for port in serial.tools.list_ports.comports():
@@ -73,30 +103,63 @@ class TelemetryReceiver:
             return False
     
     def read_message(self):
-        """Read and decode a single telemetry message"""
+        """Read and decode a single telemetry message from the COBS frame stream"""
         try:
-            # Read message size byte
-            size_byte = self.ser.read(1)
-            if not size_byte:
-                return None
-            
-            message_size = size_byte[0]
-            if message_size == 0 or message_size > 50:  # Sanity check
-                return None
-            
-            # Read message data
-            message_data = self.ser.read(message_size)
-            if len(message_data) != message_size:
+            # Messages queued from a previous frame
+            if self.pending_messages:
+                self.messages_received += 1
+                return self.decode_message(self.pending_messages.pop(0))
+
+            # Accumulate bytes until a frame delimiter arrives. A dropped byte
+            # only corrupts its own frame - the next 0x00 resynchronizes us.
+            chunk = self.ser.read(64)
+            if not chunk:
                 return None
-            
-            self.messages_received += 1
-            self.bytes_received += message_size + 1
-            
-            return self.decode_message(message_data)
-            
+            self.bytes_received += len(chunk)
+            self.frame_buffer.extend(chunk)
+
+            while FRAME_DELIMITER in self.frame_buffer:
+                end = self.frame_buffer.index(FRAME_DELIMITER)
+                frame = bytes(self.frame_buffer[:end])
+                del self.frame_buffer[:end + 1]
+                if frame:
+                    self.process_frame(frame)
+
+            if self.pending_messages:
+                self.messages_received += 1
+                return self.decode_message(self.pending_messages.pop(0))
+            return None
+
         except Exception as e:
             print(f"⚠️  Read error: {e}")
             return None
+
+    def process_frame(self, frame):
+        """COBS-decode a frame, verify its CRC16, and queue the messages inside"""
+        raw = cobs_decode(frame)
+        if raw is None or len(raw) < 3:
+            self.crc_errors += 1
+            print(f"⚠️  Malformed frame ({len(frame)} bytes)")
+            return
+
+        payload, crc_rx = raw[:-2], raw[-2] | (raw[-1] << 8)
+        if crc16_ccitt(payload) != crc_rx:
+            self.crc_errors += 1
+            print(f"⚠️  CRC mismatch on {len(payload)}-byte frame - discarded")
+            return
+
+        self.frames_received += 1
+
+        # Split the batch into [size][message] records
+        pos = 0
+        while pos < len(payload):
+            size = payload[pos]
+            pos += 1
+            if size == 0 or pos + size > len(payload):
+                print(f"⚠️  Truncated record in frame at offset {pos}")
+                break
+            self.pending_messages.append(payload[pos:pos + size])
+            pos += size
     
     def decode_message(self, data):
         """Decode protobuf message (simplified decoder)"""
@@ -218,7 +281,7 @@ class TelemetryReceiver:
 ╠══════════════════════════════════════════════════════════════╣
 ║  Port: {self.port:<10}  Baud: {self.baud:<10}  Protocol: Binary  ║
 ║  Expected: A4/A5 SoftwareSerial from Arduino Controller     ║
-║  Format: [SIZE][MSG_TYPE][SEQ][TIMESTAMP][DATA...]          ║
+║  Format: COBS frame -> [SIZE][MSG][SIZE][MSG]...[CRC16]     ║
 ╚══════════════════════════════════════════════════════════════╝
 
 Press Ctrl+C to stop monitoring...
@@ -243,6 +306,8 @@ Press Ctrl+C to stop monitoring...
         except KeyboardInterrupt:
             print(f"\n\n📊 Session Summary:")
             print(f"   Messages Received: {self.messages_received}")
+            print(f"   Frames Received: {self.frames_received}")
+            print(f"   CRC/Framing Errors: {self.crc_errors}")
             print(f"   Bytes Received: {self.bytes_received}")
             print(f"   Average Message Size: {self.bytes_received/max(1, self.messages_received):.1f} bytes")
             print(f"✅ Telemetry receiver stopped.")
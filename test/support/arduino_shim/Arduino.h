@@ -0,0 +1,103 @@
+#pragma once
+
+// Minimal Arduino core shim for the env:native benchmark/regression build.
+// Implements just enough of the core API for the controller sources to
+// compile and link on the host: timing comes from the monotonic clock, pin
+// and ADC levels are plain arrays the tests can poke directly, and the
+// serial objects swallow output (byte-counted) so Unity owns stdout.
+//
+// This is test support only - nothing here is compiled into the firmware.
+
+#include <stdint.h>
+#include <stddef.h>
+#include <stdlib.h>
+#include <string.h>
+#include <strings.h>
+#include <stdio.h>
+#include <stdarg.h>
+#include <math.h>
+#include <chrono>
+
+#define HIGH 1
+#define LOW 0
+#define INPUT 0
+#define OUTPUT 1
+#define INPUT_PULLUP 2
+#define CHANGE 1
+#define RISING 2
+#define FALLING 3
+#define LED_BUILTIN 13
+#define A0 14
+#define A1 15
+#define A2 16
+#define A3 17
+#define A4 18
+#define A5 19
+#define PROGMEM
+
+typedef uint8_t byte;
+
+// Test-visible backing stores: set a level here, then call the code under test
+inline uint8_t shimDigitalLevels[32] = {0};
+inline uint16_t shimAnalogLevels[32] = {0};
+inline uint32_t shimSerialBytesOut = 0;
+
+inline unsigned long micros() {
+    using namespace std::chrono;
+    static const steady_clock::time_point t0 = steady_clock::now();
+    return (unsigned long)duration_cast<microseconds>(steady_clock::now() - t0).count();
+}
+
+inline unsigned long millis() { return micros() / 1000UL; }
+
+inline void delay(unsigned long ms) {
+    unsigned long start = millis();
+    while (millis() - start < ms) {}
+}
+
+inline void delayMicroseconds(unsigned int us) {
+    unsigned long start = micros();
+    while (micros() - start < us) {}
+}
+
+inline void pinMode(uint8_t, uint8_t) {}
+inline void digitalWrite(uint8_t pin, uint8_t level) { if (pin < 32) shimDigitalLevels[pin] = level; }
+inline int digitalRead(uint8_t pin) { return (pin < 32) ? shimDigitalLevels[pin] : LOW; }
+inline int analogRead(uint8_t pin) { return (pin < 32) ? shimAnalogLevels[pin] : 0; }
+inline void analogReadResolution(int) {}
+inline void attachInterrupt(uint8_t, void (*)(), int) {}
+inline void detachInterrupt(uint8_t) {}
+inline uint8_t digitalPinToInterrupt(uint8_t pin) { return pin; }
+inline void interrupts() {}
+inline void noInterrupts() {}
+
+// Output sinks: every print/write is counted and discarded
+class Print {
+public:
+    size_t write(uint8_t) { shimSerialBytesOut++; return 1; }
+    size_t write(const uint8_t*, size_t n) { shimSerialBytesOut += (uint32_t)n; return n; }
+    template <typename T> size_t print(T) { return 0; }
+    size_t print(double, int) { return 0; }
+    template <typename T> size_t println(T) { shimSerialBytesOut++; return 1; }
+    size_t println(double, int) { shimSerialBytesOut++; return 1; }
+    size_t println() { shimSerialBytesOut++; return 1; }
+};
+
+class Stream : public Print {
+public:
+    int available() { return 0; }
+    int read() { return -1; }
+    int peek() { return -1; }
+    void flush() {}
+    int availableForWrite() { return 4096; }
+};
+
+class HardwareSerial : public Stream {
+public:
+    void begin(unsigned long) {}
+    void end() {}
+    operator bool() { return true; }
+};
+
+inline HardwareSerial Serial;
+inline HardwareSerial Serial1;
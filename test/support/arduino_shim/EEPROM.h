@@ -0,0 +1,32 @@
+#pragma once
+
+// RAM-backed EEPROM shim for env:native. Starts erased (0xFF) like a fresh
+// part, so the first ConfigManager load fails CRC and falls back to defaults
+// exactly as it does on new hardware; saves then round-trip in RAM.
+
+#include "Arduino.h"
+
+class EEPROMClass {
+private:
+    static const size_t EEPROM_SIZE = 8192;
+    uint8_t data[EEPROM_SIZE];
+
+public:
+    EEPROMClass() { memset(data, 0xFF, sizeof(data)); }
+
+    uint8_t read(int addr) { return (addr >= 0 && (size_t)addr < EEPROM_SIZE) ? data[addr] : 0xFF; }
+    void write(int addr, uint8_t value) { if (addr >= 0 && (size_t)addr < EEPROM_SIZE) data[addr] = value; }
+    void update(int addr, uint8_t value) { write(addr, value); }
+    unsigned int length() { return EEPROM_SIZE; }
+
+    template <typename T> T& get(int addr, T& t) {
+        if (addr >= 0 && (size_t)addr + sizeof(T) <= EEPROM_SIZE) memcpy(&t, &data[addr], sizeof(T));
+        return t;
+    }
+    template <typename T> const T& put(int addr, const T& t) {
+        if (addr >= 0 && (size_t)addr + sizeof(T) <= EEPROM_SIZE) memcpy(&data[addr], &t, sizeof(T));
+        return t;
+    }
+};
+
+inline EEPROMClass EEPROM;
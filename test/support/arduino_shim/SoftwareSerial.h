@@ -0,0 +1,12 @@
+#pragma once
+
+// SoftwareSerial shim for env:native - output is swallowed via the shared
+// Print counter, input is always empty.
+
+#include "Arduino.h"
+
+class SoftwareSerial : public Stream {
+public:
+    SoftwareSerial(uint8_t, uint8_t) {}
+    void begin(long) {}
+};
@@ -0,0 +1,16 @@
+#pragma once
+
+// I2C shim for env:native - transactions succeed with no devices attached.
+
+#include "Arduino.h"
+
+class TwoWire : public Stream {
+public:
+    void begin() {}
+    void setClock(uint32_t) {}
+    void beginTransmission(uint8_t) {}
+    uint8_t endTransmission(bool stopBit = true) { (void)stopBit; return 0; }
+    uint8_t requestFrom(uint8_t, uint8_t) { return 0; }
+};
+
+inline TwoWire Wire;
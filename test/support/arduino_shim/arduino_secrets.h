@@ -0,0 +1,14 @@
+#pragma once
+
+// Placeholder credentials for env:native only - the host build never opens a
+// network connection. The firmware build uses include/arduino_secrets.h
+// created from the template.
+
+#define SECRET_SSID "native_test"
+#define SECRET_PASS "native_test"
+#define MQTT_BROKER_HOST "127.0.0.1"
+#define MQTT_BROKER_PORT 1883
+#define MQTT_USER "native_test"
+#define MQTT_PASS "native_test"
+#define SYSLOG_SERVER_HOST "127.0.0.1"
+#define SYSLOG_SERVER_PORT 514
@@ -0,0 +1,28 @@
+#pragma once
+
+// Stored performance baselines for the native benchmark suite (ns/op).
+//
+// Ceilings are set roughly an order of magnitude above what the hot paths
+// measure on a typical x86 dev host, so the gate trips on algorithmic
+// regressions (an O(n log n) sort sneaking into the median filter, a linear
+// scan replacing the command-table binary search) rather than on host noise
+// or a slower CI runner. Tighten deliberately, with measurements, not by
+// reflex after a single fast run.
+
+// Full processCommand() dispatch of "show" - parse, validate, hash lookup,
+// and every subsystem getStatusString()
+static const uint32_t BASELINE_COMMAND_PARSE_NS = 50000;
+
+// One SlidingMedianFilter::insert() at the largest supported window (64):
+// binary search + bounded memmove, the per-sample filter cost
+static const uint32_t BASELINE_MEDIAN_INSERT_NS = 5000;
+
+// One SequenceController::update() pass in the idle state - the per-loop
+// cost every pass pays even when nothing is running
+static const uint32_t BASELINE_SEQ_UPDATE_NS = 2000;
+
+// One ConfigManager::load() - EEPROM struct read plus CRC32 validation
+static const uint32_t BASELINE_CONFIG_CRC_NS = 50000;
+
+// One Q16 counts->PSI conversion - multiply, shift, add, two clamps
+static const uint32_t BASELINE_Q16_CONVERT_NS = 100;
@@ -0,0 +1,428 @@
+// Native-host benchmark and regression suite (pio test -e native).
+//
+// Compiles the real controller sources against the Arduino shim in
+// test/support/arduino_shim and checks two things on every run:
+//   - correctness regressions in the host-testable logic (median filter
+//     against a brute-force reference, config CRC round-trip, sequence
+//     state transitions), and
+//   - performance regressions: ns/op for command parsing, filter updates,
+//     and sequence updates, gated against the ceilings in bench_baselines.h.
+
+#include <unity.h>
+#include <Arduino.h>
+#include <chrono>
+
+#include "constants.h"
+#include "median_filter.h"
+#include "config_manager.h"
+#include "command_processor.h"
+#include "sequence_controller.h"
+#include "pressure_manager.h"
+#include "pressure_sensor.h"
+#include "relay_controller.h"
+#include "safety_system.h"
+#include "system_error_manager.h"
+#include "input_manager.h"
+#include "telemetry_manager.h"
+#include "flight_recorder.h"
+#include "status_cache.h"
+#include "scratch_arena.h"
+
+#include "bench_baselines.h"
+
+// ---------------------------------------------------------------------------
+// Globals normally defined in main.cpp (excluded from the native build)
+// ---------------------------------------------------------------------------
+TelemetryManager telemetryManager;
+FlightRecorder flightRecorder;
+StatusCache statusCache;
+ScratchArena scratchArena;
+PressureManager pressureManager;
+RelayController* g_relayController = nullptr;
+bool g_limitExtendActive = false;
+bool g_limitRetractActive = false;
+bool g_debugEnabled = false;
+bool g_emergencyStopActive = false;
+bool g_emergencyStopLatched = false;
+SystemState currentSystemState = SYS_RUNNING;
+
+void debugPrintf(const char* fmt, ...) {
+    (void)fmt;  // Swallowed on the host - Unity owns stdout
+}
+
+// ---------------------------------------------------------------------------
+// Harness components, wired the way initializeSystem() wires them
+// ---------------------------------------------------------------------------
+static ConfigManager configManager;
+static RelayController relayController;
+static SequenceController sequenceController;
+static SafetySystem safetySystem;
+static SystemErrorManager systemErrorManager;
+static InputManager inputManager;
+static CommandProcessor commandProcessor;
+
+// ---------------------------------------------------------------------------
+// Benchmark helper: warm the caches, then time iterations ns/op
+// ---------------------------------------------------------------------------
+template <typename F>
+static double benchNsPerOp(F op, uint32_t iterations) {
+    using namespace std::chrono;
+    for (uint32_t i = 0; i < iterations / 10 + 1; i++) op(i);
+    steady_clock::time_point t0 = steady_clock::now();
+    for (uint32_t i = 0; i < iterations; i++) op(i);
+    steady_clock::time_point t1 = steady_clock::now();
+    return (double)duration_cast<nanoseconds>(t1 - t0).count() / (double)iterations;
+}
+
+static void reportNsPerOp(const char* label, double nsPerOp, uint32_t ceiling) {
+    char msg[96];
+    snprintf(msg, sizeof(msg), "%s: %.1f ns/op (ceiling %lu)",
+             label, nsPerOp, (unsigned long)ceiling);
+    TEST_MESSAGE(msg);
+}
+
+// Deterministic sample stream (xorshift) so runs are comparable
+static uint32_t prngState = 0x12345678;
+static uint16_t nextSample() {
+    prngState ^= prngState << 13;
+    prngState ^= prngState >> 17;
+    prngState ^= prngState << 5;
+    return (uint16_t)(prngState & 0x3FF);  // 10-bit ADC range
+}
+
+// ---------------------------------------------------------------------------
+// Correctness regressions
+// ---------------------------------------------------------------------------
+
+// Median filter must agree with a brute-force sorted reference at every
+// window size boundary and during warm-up
+static void test_median_filter_matches_reference() {
+    const uint8_t windows[] = {MEDIAN_WINDOW_MIN, 17, DEFAULT_MEDIAN_WINDOW, 63, MEDIAN_WINDOW_MAX};
+    for (size_t w = 0; w < sizeof(windows); w++) {
+        SlidingMedianFilter filter;
+        filter.reset(windows[w]);
+
+        uint16_t history[MEDIAN_WINDOW_MAX];
+        uint16_t filled = 0;
+
+        for (int i = 0; i < 2000; i++) {
+            uint16_t sample = nextSample();
+            uint16_t median = filter.insert(sample);
+
+            // Maintain the brute-force reference window
+            if (filled < windows[w]) {
+                history[filled++] = sample;
+            } else {
+                memmove(history, history + 1, (windows[w] - 1) * sizeof(uint16_t));
+                history[windows[w] - 1] = sample;
+            }
+            uint16_t sorted[MEDIAN_WINDOW_MAX];
+            memcpy(sorted, history, filled * sizeof(uint16_t));
+            for (uint16_t a = 1; a < filled; a++) {
+                uint16_t key = sorted[a];
+                int b = a - 1;
+                while (b >= 0 && sorted[b] > key) { sorted[b + 1] = sorted[b]; b--; }
+                sorted[b + 1] = key;
+            }
+            TEST_ASSERT_EQUAL_UINT16(sorted[filled / 2], median);
+        }
+    }
+}
+
+// Config CRC32 must round-trip through the (RAM-backed) EEPROM: a fresh
+// part fails validation, a saved config loads back clean
+static void test_config_crc_roundtrip() {
+    // Erased EEPROM: load must reject the bad magic
+    TEST_ASSERT_FALSE(configManager.load());
+
+    // begin() falls back to defaults and commits them - the saved image
+    // must then validate
+    configManager.begin();
+    TEST_ASSERT_TRUE(configManager.load());
+
+    // A changed parameter survives the save/load cycle with a fresh CRC
+    configManager.setMedianWindow(48);
+    configManager.save();
+    configManager.flushSave();
+
+    TEST_ASSERT_TRUE(configManager.load());
+    TEST_ASSERT_EQUAL_UINT8(48, configManager.getMedianWindow());
+}
+
+// Profile banks must round-trip a config through EEPROM, leave the live
+// slot pointing at the loaded profile, and keep empty slots invisible
+static void test_profile_bank_roundtrip() {
+    configManager.begin();
+
+    configManager.setMedianWindow(32);
+    TEST_ASSERT_TRUE(configManager.profileSave(0, "summer"));
+    configManager.flushSave();
+
+    // Diverge the live config, then pull the profile back
+    configManager.setMedianWindow(56);
+    configManager.save();
+    configManager.flushSave();
+
+    char name[PROFILE_NAME_LEN];
+    TEST_ASSERT_TRUE(configManager.profileGetName(0, name, sizeof(name)));
+    TEST_ASSERT_EQUAL(0, strcmp(name, "summer"));
+    TEST_ASSERT_FALSE(configManager.profileGetName(1, name, sizeof(name)));
+
+    TEST_ASSERT_TRUE(configManager.profileLoad(0));
+    configManager.flushSave();
+    TEST_ASSERT_EQUAL_UINT8(32, configManager.getMedianWindow());
+
+    // The live slot now holds the profile - a reboot would load it
+    TEST_ASSERT_TRUE(configManager.load());
+    TEST_ASSERT_EQUAL_UINT8(32, configManager.getMedianWindow());
+
+    // Out-of-range slot is rejected
+    TEST_ASSERT_FALSE(configManager.profileLoad(PROFILE_SLOT_COUNT));
+
+    // A live save mid-journal must survive a profileSave retarget - the
+    // writer flushes the in-flight region before aiming at the bank
+    configManager.setMedianWindow(48);
+    configManager.save();
+    configManager.update();  // Commit only the first chunk
+    TEST_ASSERT_TRUE(configManager.profileSave(1, "winter"));
+    configManager.flushSave();
+    TEST_ASSERT_TRUE(configManager.load());
+    TEST_ASSERT_EQUAL_UINT8(48, configManager.getMedianWindow());
+}
+
+// The Q16 fixed-point conversion must agree with the float reference
+// model on both the extended (A1) and generic (A5) paths across the full
+// ADC range, including the clamp regions
+static void test_q16_conversion_matches_float() {
+    PressureSensorChannel oil;
+    oil.begin(HYDRAULIC_OIL_PRESSURE_PIN, HYDRAULIC_MAX_PRESSURE_PSI);
+    oil.setSensorGain(1.02f);
+    oil.setSensorOffset(-3.5f);
+
+    PressureSensorChannel main;
+    main.begin(HYDRAULIC_PRESSURE_PIN, HYDRAULIC_MAX_PRESSURE_PSI);
+
+    for (int counts = 0; counts <= 1023; counts++) {
+        float volts = ((float)counts / 1024.0f) * DEFAULT_ADC_VREF;
+
+        // A5 reference: clamped linear 0..SENSOR_MAX_VOLTAGE with gain+offset
+        float v = volts;
+        if (v < SENSOR_MIN_VOLTAGE) v = SENSOR_MIN_VOLTAGE;
+        if (v > SENSOR_MAX_VOLTAGE) v = SENSOR_MAX_VOLTAGE;
+        float oilRef = (v / SENSOR_MAX_VOLTAGE) * HYDRAULIC_MAX_PRESSURE_PSI * 1.02f - 3.5f;
+        float oilGot = (float)oil.countsToPsiQ16((int32_t)counts << 16) / 65536.0f;
+        TEST_ASSERT_FLOAT_WITHIN(0.25f, oilRef, oilGot);
+
+        // A1 reference: extended scaling with over-range headroom, reported
+        // value clamped to 0..nominal
+        const float nominal = HYDRAULIC_MAX_PRESSURE_PSI;
+        const float span = (1.0f + MAIN_PRESSURE_EXT_NEG_FRAC + MAIN_PRESSURE_EXT_POS_FRAC) * nominal;
+        float mainRef = (volts / MAIN_PRESSURE_EXT_FSV) * span - MAIN_PRESSURE_EXT_NEG_FRAC * nominal;
+        if (mainRef < 0.0f) mainRef = 0.0f;
+        if (mainRef > nominal) mainRef = nominal;
+        float mainGot = (float)main.countsToPsiQ16((int32_t)counts << 16) / 65536.0f;
+        TEST_ASSERT_FLOAT_WITHIN(0.25f, mainRef, mainGot);
+    }
+}
+
+// The raw overpressure comparator must need M-of-N confirmation: a single
+// glitch sample over the ceiling stays quiet, a confirmed run trips and
+// latches until re-armed
+static void test_overpressure_comparator_m_of_n() {
+    PressureSensorChannel ch;
+    ch.begin(HYDRAULIC_PRESSURE_PIN, HYDRAULIC_MAX_PRESSURE_PSI);
+    ch.setOverpressureCeiling(DEFAULT_OVERPRESSURE_CEILING_PSI);
+
+    // A1 extended model: counts at the ceiling PSI
+    const float nominal = HYDRAULIC_MAX_PRESSURE_PSI;
+    const float span = (1.0f + MAIN_PRESSURE_EXT_NEG_FRAC + MAIN_PRESSURE_EXT_POS_FRAC) * nominal;
+    float ceilingVolts = (DEFAULT_OVERPRESSURE_CEILING_PSI + MAIN_PRESSURE_EXT_NEG_FRAC * nominal)
+                         / span * MAIN_PRESSURE_EXT_FSV;
+    uint16_t overCounts = (uint16_t)(ceilingVolts / DEFAULT_ADC_VREF * 1024.0f) + 4;
+    uint16_t underCounts = (uint16_t)(ceilingVolts / DEFAULT_ADC_VREF * 1024.0f) - 8;
+
+    // One glitch sample over the ceiling must not trip
+    for (int i = 0; i < 8; i++) ch.isrRecordSample(underCounts);
+    ch.isrRecordSample(overCounts);
+    for (int i = 0; i < 8; i++) ch.isrRecordSample(underCounts);
+    TEST_ASSERT_FALSE(ch.overpressureTripPending());
+    TEST_ASSERT_FALSE(ch.overpressureTripLatched());
+
+    // M consecutive samples over the ceiling must trip and latch
+    for (int i = 0; i < OVERPRESSURE_CONFIRM_M; i++) ch.isrRecordSample(overCounts);
+    TEST_ASSERT_TRUE(ch.overpressureTripPending());
+    TEST_ASSERT_TRUE(ch.overpressureTripLatched());
+
+    // Servicing clears pending but the latch holds through more samples
+    ch.serviceOverpressureTrip();
+    for (int i = 0; i < 8; i++) ch.isrRecordSample(overCounts);
+    TEST_ASSERT_FALSE(ch.overpressureTripPending());
+    TEST_ASSERT_TRUE(ch.overpressureTripLatched());
+
+    // Re-arm: quiet input stays quiet, a new confirmed run trips again
+    ch.rearmOverpressure();
+    for (int i = 0; i < 8; i++) ch.isrRecordSample(underCounts);
+    TEST_ASSERT_FALSE(ch.overpressureTripPending());
+    for (int i = 0; i < OVERPRESSURE_CONFIRM_M; i++) ch.isrRecordSample(overCounts);
+    TEST_ASSERT_TRUE(ch.overpressureTripPending());
+}
+
+// The scratch arena must hand out distinct slots, refuse when exhausted
+// (counting the overflow), and recycle released slots
+static void test_scratch_arena_exhaustion() {
+    char* held[SCRATCH_SLOT_COUNT];
+    for (uint8_t i = 0; i < SCRATCH_SLOT_COUNT; i++) {
+        held[i] = scratchArena.acquire();
+        TEST_ASSERT_TRUE(held[i] != nullptr);
+        for (uint8_t j = 0; j < i; j++) {
+            TEST_ASSERT_TRUE(held[i] != held[j]);
+        }
+    }
+    TEST_ASSERT_EQUAL_UINT8(SCRATCH_SLOT_COUNT, scratchArena.slotsInUse());
+
+    // Exhausted arena refuses and counts the overflow
+    uint32_t overflowBefore = scratchArena.getOverflowCount();
+    TEST_ASSERT_TRUE(scratchArena.acquire() == nullptr);
+    TEST_ASSERT_EQUAL(overflowBefore + 1, scratchArena.getOverflowCount());
+
+    // A released slot is handed out again
+    scratchArena.release(held[1]);
+    char* again = scratchArena.acquire();
+    TEST_ASSERT_TRUE(again == held[1]);
+    scratchArena.release(again);
+
+    for (uint8_t i = 0; i < SCRATCH_SLOT_COUNT; i++) {
+        if (i != 1) scratchArena.release(held[i]);
+    }
+    TEST_ASSERT_EQUAL_UINT8(0, scratchArena.slotsInUse());
+
+    // The RAII wrapper returns its slot on scope exit
+    {
+        ScratchBuffer scoped;
+        TEST_ASSERT_TRUE(scoped.valid());
+        TEST_ASSERT_EQUAL_UINT8(1, scratchArena.slotsInUse());
+    }
+    TEST_ASSERT_EQUAL_UINT8(0, scratchArena.slotsInUse());
+}
+
+// Manual extend must enter and leave its state cleanly
+static void test_sequence_manual_extend_transitions() {
+    sequenceController.reset();
+    TEST_ASSERT_EQUAL(SEQ_IDLE, sequenceController.getState());
+
+    TEST_ASSERT_TRUE(sequenceController.startManualExtend());
+    TEST_ASSERT_EQUAL(SEQ_MANUAL_EXTEND_ACTIVE, sequenceController.getState());
+    TEST_ASSERT_TRUE(sequenceController.isManualActive());
+
+    TEST_ASSERT_TRUE(sequenceController.stopManualOperation());
+    TEST_ASSERT_EQUAL(SEQ_IDLE, sequenceController.getState());
+}
+
+// ---------------------------------------------------------------------------
+// Performance regressions
+// ---------------------------------------------------------------------------
+
+static void test_bench_command_parsing() {
+    static char cmd[COMMAND_BUFFER_SIZE];
+    static char response[SHARED_BUFFER_SIZE];
+
+    // fromMqtt: the looser rate-limit path annotates instead of rejecting,
+    // so every iteration exercises the full parse + dispatch
+    double nsPerOp = benchNsPerOp([](uint32_t) {
+        strcpy(cmd, "show");
+        commandProcessor.processCommand(cmd, true, response, sizeof(response));
+    }, 20000);
+
+    reportNsPerOp("command parse+dispatch (show)", nsPerOp, BASELINE_COMMAND_PARSE_NS);
+    TEST_ASSERT_LESS_THAN_UINT32(BASELINE_COMMAND_PARSE_NS, (uint32_t)nsPerOp);
+}
+
+static void test_bench_median_insert() {
+    static SlidingMedianFilter filter;
+    filter.reset(MEDIAN_WINDOW_MAX);  // Worst-case window
+
+    double nsPerOp = benchNsPerOp([](uint32_t) {
+        filter.insert(nextSample());
+    }, 200000);
+
+    reportNsPerOp("median insert (window 64)", nsPerOp, BASELINE_MEDIAN_INSERT_NS);
+    TEST_ASSERT_LESS_THAN_UINT32(BASELINE_MEDIAN_INSERT_NS, (uint32_t)nsPerOp);
+}
+
+static void test_bench_sequence_update() {
+    sequenceController.reset();
+
+    double nsPerOp = benchNsPerOp([](uint32_t) {
+        sequenceController.update();
+    }, 200000);
+
+    reportNsPerOp("sequence update (idle)", nsPerOp, BASELINE_SEQ_UPDATE_NS);
+    TEST_ASSERT_LESS_THAN_UINT32(BASELINE_SEQ_UPDATE_NS, (uint32_t)nsPerOp);
+}
+
+static PressureSensorChannel benchChannel;
+static volatile int32_t q16Sink;
+
+static void test_bench_q16_conversion() {
+    benchChannel.begin(HYDRAULIC_PRESSURE_PIN, HYDRAULIC_MAX_PRESSURE_PSI);
+
+    double nsPerOp = benchNsPerOp([](uint32_t i) {
+        q16Sink = benchChannel.countsToPsiQ16((int32_t)(i & 0x3FF) << 16);
+    }, 2000000);
+
+    reportNsPerOp("Q16 counts->PSI conversion", nsPerOp, BASELINE_Q16_CONVERT_NS);
+    TEST_ASSERT_LESS_THAN_UINT32(BASELINE_Q16_CONVERT_NS, (uint32_t)nsPerOp);
+}
+
+static void test_bench_config_crc() {
+    // Saved once in test_config_crc_roundtrip, so every load validates CRC
+    double nsPerOp = benchNsPerOp([](uint32_t) {
+        configManager.load();
+    }, 20000);
+
+    reportNsPerOp("config load + CRC32", nsPerOp, BASELINE_CONFIG_CRC_NS);
+    TEST_ASSERT_LESS_THAN_UINT32(BASELINE_CONFIG_CRC_NS, (uint32_t)nsPerOp);
+}
+
+// ---------------------------------------------------------------------------
+
+void setUp() {}
+void tearDown() {}
+
+int main(int, char**) {
+    // Wire components the way initializeSystem() does, minus hardware init
+    g_relayController = &relayController;
+    relayController.setErrorManager(&systemErrorManager);
+    safetySystem.setRelayController(&relayController);
+    safetySystem.setSequenceController(&sequenceController);
+    sequenceController.setErrorManager(&systemErrorManager);
+    sequenceController.setInputManager(&inputManager);
+    sequenceController.setSafetySystem(&safetySystem);
+    configManager.setSystemErrorManager(&systemErrorManager);
+
+    commandProcessor.setConfigManager(&configManager);
+    commandProcessor.setPressureManager(&pressureManager);
+    commandProcessor.setSequenceController(&sequenceController);
+    commandProcessor.setRelayController(&relayController);
+    commandProcessor.setSafetySystem(&safetySystem);
+    commandProcessor.setSystemErrorManager(&systemErrorManager);
+    commandProcessor.setInputManager(&inputManager);
+
+    UNITY_BEGIN();
+
+    RUN_TEST(test_median_filter_matches_reference);
+    RUN_TEST(test_config_crc_roundtrip);
+    RUN_TEST(test_profile_bank_roundtrip);
+    RUN_TEST(test_q16_conversion_matches_float);
+    RUN_TEST(test_overpressure_comparator_m_of_n);
+    RUN_TEST(test_scratch_arena_exhaustion);
+    RUN_TEST(test_sequence_manual_extend_transitions);
+
+    RUN_TEST(test_bench_command_parsing);
+    RUN_TEST(test_bench_median_insert);
+    RUN_TEST(test_bench_sequence_update);
+    RUN_TEST(test_bench_q16_conversion);
+    RUN_TEST(test_bench_config_crc);
+
+    return UNITY_END();
+}